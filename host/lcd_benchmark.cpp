@@ -0,0 +1,146 @@
+/** \file lcd_benchmark.cpp LCD primitives benchmark
+ *
+ * Host program that draws each LCD primitive on the controller model of
+ * lcd_model.h and reports what it costs on the wire: SPI frames, #CS
+ * assertions, windows and the time the frames take at the SSP0 clock
+ * set by initialize_SSP0(). Run it after each change and compare the
+ * output to track regressions.
+ *
+ * Usage: lcd_benchmark [-j]
+ *  -j  JSON output instead of CSV
+ *
+ * Build it with the host compiler:
+ * \verbatim
+   g++ -Ihost -Iinclude -o lcd_benchmark host/lcd_benchmark.cpp host/lcd_model.cpp src/lcd.cpp src/fonts.cpp
+   \endverbatim
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <targets/LPC2378.h>
+#include <olimex-lpc2378-stk/lcd.h>
+#include "lcd_model.h"
+
+/** SSP0 peripheral clock: the 72 MHz CCLK set by initialize_LPC2378()
+ * divided by 4, the PCLKSEL0 reset value
+ */
+#define SSP0_PCLK 18000000
+
+/// Primitive measured
+struct benchmark
+{
+    const char *name;          ///< Name in the output
+    void (*draw)( void );      ///< Draws the primitive once
+};
+
+static void clear( void ) { LCD_clear(); }
+static void pixel( void ) { LCD_pixel( 66, 66, RED ); }
+static void line_horizontal( void ) { LCD_line( 66, 0, 66, 131, RED ); }
+static void line_vertical( void ) { LCD_line( 0, 66, 131, 66, RED ); }
+static void line_diagonal( void ) { LCD_line( 0, 0, 131, 131, RED ); }
+static void line_shallow( void ) { LCD_line( 50, 0, 82, 131, RED ); }
+static void line_steep( void ) { LCD_line( 0, 50, 131, 82, RED ); }
+static void rectangle_filled( void ) { LCD_rectangle( 16, 16, 115, 115, FILL, RED ); }
+static void rectangle_hollow( void ) { LCD_rectangle( 16, 16, 115, 115, NO_FILL, RED ); }
+static void circumference( void ) { LCD_circumference( 66, 66, 50, RED ); }
+static void string_small( void ) { LCD_print_string( (char *)"Hello, world!", 60, 10, SMALL_FONT, BLACK, WHITE ); }
+static void string_medium( void ) { LCD_print_string( (char *)"Hello, world!", 60, 10, MEDIUM_FONT, BLACK, WHITE ); }
+static void string_big( void ) { LCD_print_string( (char *)"Hello, world!", 60, 10, BIG_FONT, BLACK, WHITE ); }
+
+static const struct benchmark benchmarks[] = {
+    { "clear", clear },
+    { "pixel", pixel },
+    { "line_horizontal", line_horizontal },
+    { "line_vertical", line_vertical },
+    { "line_diagonal", line_diagonal },
+    { "line_shallow", line_shallow },
+    { "line_steep", line_steep },
+    { "rectangle_filled", rectangle_filled },
+    { "rectangle_hollow", rectangle_hollow },
+    { "circumference", circumference },
+    { "string_small", string_small },
+    { "string_medium", string_medium },
+    { "string_big", string_big },
+    };
+
+int main( int argc, char **argv )
+{
+    struct lcd_model_counters c;
+    unsigned int i, count;
+    unsigned long bit_rate, frame_bits;
+    double microseconds;
+    int json = 0;
+
+    for( i = 1; i < (unsigned int)argc; i++ )
+    {
+        if( !strcmp( argv[i], "-j" ) )
+            json = 1;
+        else
+        {
+            fprintf( stderr, "Usage: %s [-j]\n", argv[0] );
+            return 1;
+        }
+    }
+
+    lcd_model_reset();
+    initialize_LCD();
+
+    // The clock and frame size are taken from the registers initialize_SSP0() set
+    bit_rate = SSP0_PCLK / (SSP0CPSR * (((SSP0CR0 >> 8) & 0xFF) + 1));
+    frame_bits = (SSP0CR0 & 0xF) + 1;
+
+    if( json )
+        printf( "{\n  \"bit_rate\": %lu,\n  \"frame_bits\": %lu,\n  \"primitives\": [\n",
+                bit_rate, frame_bits );
+    else
+        printf( "primitive,frames,commands,windows,pixels,selects,microseconds\n" );
+
+    count = sizeof benchmarks / sizeof benchmarks[0];
+    for( i = 0; i < count; i++ )
+    {
+        // Every primitive starts from the same state
+        LCD_clear();
+        LCD_glyph_cache_clear();
+
+        lcd_model_reset_counters();
+        benchmarks[i].draw();
+        lcd_model_get_counters( &c );
+
+        microseconds = c.frames * frame_bits * 1e6 / bit_rate;
+
+        if( json )
+            printf( "    { \"primitive\": \"%s\", \"frames\": %lu, \"commands\": %lu, "
+                    "\"windows\": %lu, \"pixels\": %lu, \"selects\": %lu, "
+                    "\"microseconds\": %.1f }%s\n",
+                    benchmarks[i].name, c.frames, c.commands, c.windows, c.pixels,
+                    c.selects, microseconds, (i + 1 < count) ? "," : "" );
+        else
+            printf( "%s,%lu,%lu,%lu,%lu,%lu,%.1f\n", benchmarks[i].name, c.frames,
+                    c.commands, c.windows, c.pixels, c.selects, microseconds );
+    }
+
+    if( json )
+        printf( "  ]\n}\n" );
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+/// \file lcd_model.cpp LCD controller model
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <targets/LPC2378.h>
+#include <olimex-lpc2378-stk/init.h>
+#include <olimex-lpc2378-stk/lcd.h>
+#include "lcd_model.h"
+
+/// Transmit queue service routine of src/lcd.cpp
+void ISR_SSP0( void );
+/// GPDMA service routine of src/lcd.cpp
+void ISR_GPDMA( void );
+
+static void ssp_data( unsigned long value );
+static void ssp_interrupt_mask( unsigned long value );
+static void cs_deassert( unsigned long value );
+static void cs_assert( unsigned long value );
+static void dma_channel( unsigned long value );
+
+hooked_register SSP0DR = { ssp_data, 0 };
+hooked_register SSP0IMSC = { ssp_interrupt_mask, 0 };
+hooked_register FIO1SET = { cs_deassert, 0 };
+hooked_register FIO1CLR = { cs_assert, 0 };
+hooked_register DMACC0Configuration = { dma_channel, 0 };
+
+// The transmit FIFO is never full nor busy: the frames are decoded at once
+volatile unsigned long SSP0SR = SSP0SR_TFE | SSP0SR_TNF;
+volatile unsigned long SSP0CR0, SSP0CR1, SSP0CPSR, SSP0RIS, SSP0MIS, SSP0ICR, SSP0DMACR;
+volatile unsigned long PINSEL1, PINSEL3, PINMODE1, FIO1DIR, FIO3DIR, FIO3SET, FIO3CLR;
+volatile unsigned long DMACIntStatus, DMACIntTCStatus, DMACIntTCClear, DMACIntErrorStatus,
+                       DMACIntErrClr, DMACConfiguration,
+                       DMACC0SrcAddr, DMACC0DestAddr, DMACC0LLI, DMACC0Control,
+                       DMACC1SrcAddr, DMACC1DestAddr, DMACC1LLI, DMACC1Control,
+                       DMACC1Configuration;
+volatile unsigned long PWM1TCR, PWM1MCR, PWM1PCR, PWM1PR, PWM1MR0, PWM1MR6, PWM1LER;
+volatile unsigned long T0TCR, T0MCR, T0PR, T0MR0, T0IR;
+volatile unsigned long DACR;
+volatile unsigned long VICIntEnable, VICIntEnClr, VICIntSelect, VICAddress,
+                       VICVectAddr4, VICVectPriority4, VICVectAddr10, VICVectPriority10,
+                       VICVectAddr25, VICVectPriority25;
+volatile unsigned long PCONP, SCS, PLLCON, PLLCFG, PLLSTAT, PLLFEED, CLKSRCSEL,
+                       CCLKCFG, USBCLKCFG, MAMCR, MAMTIM, MEMMAP, PCLKSEL0, PCLKSEL1;
+
+/// Controller state
+static struct
+{
+    int ram[132][132];       ///< Display RAM, 12-bit colors by page and column
+    int command;             ///< Last command received
+    int count;               ///< Parameters received since the command
+    int x0, x1, y0, y1;      ///< Window set by PASET and CASET
+    int x, y;                ///< Next RAMWR position
+    int eight_bit;           ///< 8-bit color mode set by DATCTL
+    int levels[20];          ///< RGBSET8 levels: 8 red, 8 green and 4 blue
+    int first_byte;          ///< First byte of a 12-bit pixel pair
+    int second_byte;         ///< Second byte of a 12-bit pixel pair
+    int top, bottom, start;  ///< Scroll area and start set by ASCSET and SCSTART, in blocks
+    int selected;            ///< #CS asserted
+} lcd;
+
+static struct lcd_model_counters counters;
+
+/// ISR_SSP0() is running, so setting the interruption mask does not call it again
+static int in_ssp_interrupt;
+
+/// Write a pixel at the RAMWR position and advance it through the window
+static void write_ram( int color )
+{
+    if( lcd.x >= 0 && lcd.x < 132 && lcd.y >= 0 && lcd.y < 132 )
+        lcd.ram[lcd.x][lcd.y] = color;
+    counters.pixels++;
+
+    // The column address advances first
+    if( ++lcd.y > lcd.y1 )
+    {
+        lcd.y = lcd.y0;
+        if( ++lcd.x > lcd.x1 )
+            lcd.x = lcd.x0;
+    }
+}
+
+/// Decode a parameter of the last command
+static void datum( int d )
+{
+    switch( lcd.command )
+    {
+    case PASET:
+        if( lcd.count == 0 ) lcd.x0 = d;
+        if( lcd.count == 1 ) lcd.x1 = d;
+        break;
+
+    case CASET:
+        if( lcd.count == 0 ) lcd.y0 = d;
+        if( lcd.count == 1 ) lcd.y1 = d;
+        break;
+
+    case DATCTL:
+        // The third parameter selects 8 grayscales (8-bit) or 16 (12-bit)
+        if( lcd.count == 2 )
+            lcd.eight_bit = (d & 7) == 1;
+        break;
+
+    case RGBSET8:
+        if( lcd.count < 20 )
+            lcd.levels[lcd.count] = d & 0xF;
+        break;
+
+    case RAMWR:
+        if( lcd.eight_bit )
+            write_ram( (lcd.levels[d >> 5] << 8) | (lcd.levels[8 + ((d >> 2) & 7)] << 4) |
+                       lcd.levels[16 + (d & 3)] );
+        else if( lcd.count % 3 == 0 )
+            lcd.first_byte = d;
+        else if( lcd.count % 3 == 1 )
+        {
+            lcd.second_byte = d;
+            write_ram( (lcd.first_byte << 4) | (d >> 4) );
+        }
+        else
+            write_ram( ((lcd.second_byte & 0xF) << 8) | d );
+        break;
+
+    case ASCSET:
+        if( lcd.count == 0 ) lcd.top = d;
+        if( lcd.count == 1 ) lcd.bottom = d;
+        break;
+
+    case SCSTART:
+        if( lcd.count == 0 ) lcd.start = d;
+        break;
+    }
+
+    lcd.count++;
+}
+
+/// Decode a 9-bit frame: a command, or a parameter if the bit 8 is set
+static void frame( unsigned int value )
+{
+    counters.frames++;
+    if( !lcd.selected )
+        counters.unselected++;
+
+    if( value & 0x100 )
+    {
+        datum( value & 0xFF );
+        return;
+    }
+
+    lcd.command = value & 0xFF;
+    lcd.count = 0;
+    counters.commands++;
+
+    if( lcd.command == RAMWR )
+    {
+        counters.windows++;
+        lcd.x = lcd.x0;
+        lcd.y = lcd.y0;
+    }
+}
+
+static void ssp_data( unsigned long value )
+{
+    frame( value & 0x1FF );
+}
+
+/// Run the transmit queue service routine when its interruption is enabled
+static void ssp_interrupt_mask( unsigned long value )
+{
+    if( (value & (1<<3)) && (VICIntEnable & (1<<10)) && !in_ssp_interrupt )
+    {
+        in_ssp_interrupt = 1;
+        ISR_SSP0();
+        in_ssp_interrupt = 0;
+    }
+}
+
+static void cs_deassert( unsigned long value )
+{
+    if( value & (1<<21) )
+        lcd.selected = 0;
+}
+
+static void cs_assert( unsigned long value )
+{
+    if( (value & (1<<21)) && !lcd.selected )
+    {
+        lcd.selected = 1;
+        counters.selects++;
+    }
+}
+
+/// Run a GPDMA channel 0 transfer to the SSP0 at once
+static void dma_channel( unsigned long value )
+{
+    unsigned long control = DMACC0Control;
+    const unsigned char *source = (const unsigned char *)DMACC0SrcAddr;
+    unsigned int i, count, width, frame_value;
+
+    if( !(value & 1) || !(DMACConfiguration & 1) || DMACC0DestAddr != (unsigned long)&SSP0DR )
+        return;
+
+    count = control & 0xFFF;
+    width = 1 << ((control >> 18) & 7);
+
+    for( i = 0; i < count; i++ )
+    {
+        if( width == 1 )
+            frame_value = *source;
+        else if( width == 2 )
+            frame_value = *(const unsigned short *)source;
+        else
+            frame_value = *(const unsigned int *)source;
+
+        // Source increment
+        if( control & (1<<26) )
+            source += width;
+
+        frame( frame_value & 0x1FF );
+        counters.dma_frames++;
+    }
+
+    // The channel disables itself at the terminal count
+    DMACC0Configuration.value &= ~1UL;
+    DMACIntTCStatus |= 1;
+
+    if( (value & (1<<15)) && (VICIntEnable & (1<<25)) )
+        ISR_GPDMA();
+}
+
+void enable_IRQ( void )
+{
+}
+
+void enable_FIQ( void )
+{
+}
+
+void lcd_model_reset( void )
+{
+    memset( &lcd, 0, sizeof lcd );
+
+    lcd.x1 = 131;
+    lcd.y1 = 131;
+    lcd.bottom = 32;
+
+    lcd_model_reset_counters();
+}
+
+void lcd_model_reset_counters( void )
+{
+    memset( &counters, 0, sizeof counters );
+}
+
+void lcd_model_get_counters( struct lcd_model_counters *c )
+{
+    *c = counters;
+}
+
+int lcd_model_ram( int x, int y )
+{
+    if( x < 0 || x > 131 || y < 0 || y > 131 ) return 0;
+
+    return lcd.ram[x][y];
+}
+
+int lcd_model_pixel( int x, int y )
+{
+    int top = lcd.top * 4;
+    int height = (lcd.bottom - lcd.top + 1) * 4;
+    int offset;
+
+    // The lines of the scroll area are shown from the start block on
+    if( height > 0 && x >= top && x < top + height )
+    {
+        offset = ((lcd.start - lcd.top) * 4) % height;
+        if( offset < 0 ) offset += height;
+        x = top + (x - top + offset) % height;
+    }
+
+    return lcd_model_ram( x, y );
+}
+
+int lcd_model_write_ppm( const char *path )
+{
+    FILE *f;
+    int x, y, color;
+
+    f = fopen( path, "wb" );
+    if( !f ) return -1;
+
+    // 4-bit samples, so the colors are written as they are
+    fprintf( f, "P6\n132 132\n15\n" );
+
+    for( x = 131; x >= 0; x-- )
+        for( y = 0; y < 132; y++ )
+        {
+            color = lcd_model_pixel( x, y );
+            fputc( (color >> 8) & 0xF, f );
+            fputc( (color >> 4) & 0xF, f );
+            fputc( color & 0xF, f );
+        }
+
+    return fclose( f ) ? -1 : 0;
+}
@@ -0,0 +1,99 @@
+/** \file lcd_model.h LCD controller model
+ *
+ * Software model of the S1D15G10 LCD controller for host builds of the
+ * library. The SSP0 frames written by src/lcd.cpp are decoded as the
+ * controller would: PASET, CASET and RAMWR fill a 132x132 display RAM in
+ * 12 or 8-bit color (DATCTL and RGBSET8), and ASCSET and SCSTART scroll
+ * what is shown. The GPDMA channel 0 and the transmit queue interruption
+ * are run at once, so every call finishes before returning.
+ *
+ * The model counts the frames, commands and windows sent, so the wire
+ * cost of a drawing call can be measured by resetting the counters
+ * before it and reading them after it. The screen can be saved as a PPM
+ * picture to check the rendering.
+ *
+ * Build a host program with the host directory first in the include path:
+ * \verbatim
+   g++ -Ihost -Iinclude -o program program.cpp host/lcd_model.cpp src/lcd.cpp src/fonts.cpp
+   \endverbatim
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __LCD_MODEL_H__
+#define __LCD_MODEL_H__
+
+/// Traffic counted by the model
+struct lcd_model_counters
+{
+    unsigned long frames;       ///< 9-bit frames received, commands included
+    unsigned long commands;     ///< Command frames
+    unsigned long windows;      ///< RAMWR commands, one per window written
+    unsigned long pixels;       ///< Pixels written to the display RAM
+    unsigned long selects;      ///< Times the #CS was asserted
+    unsigned long dma_frames;   ///< Frames moved by the GPDMA
+    unsigned long unselected;   ///< Frames sent with the #CS deasserted, a bug
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** Bring the model to its power-on state
+   * The display RAM is cleared to black, the scroll and color mode are
+   * reset and so are the counters.
+   */
+  void lcd_model_reset( void );
+
+  /// Reset the counters
+  void lcd_model_reset_counters( void );
+
+  /** Read the counters
+   * \param counters Where the counters are copied
+   */
+  void lcd_model_get_counters( struct lcd_model_counters *counters );
+
+  /** Read a pixel of the display RAM
+   * \param x X coordinate, the page address
+   * \param y Y coordinate, the column address
+   * \return 12-bit color
+   */
+  int lcd_model_ram( int x, int y );
+
+  /** Read a pixel as shown on the screen, after the scroll
+   * \param x X coordinate, 0 for the bottom line
+   * \param y Y coordinate
+   * \return 12-bit color
+   */
+  int lcd_model_pixel( int x, int y );
+
+  /** Save the screen as a binary PPM picture
+   * The biggest X coordinate is the top of the picture.
+   * \param path File name
+   * \return 0, or -1 if the file could not be written
+   */
+  int lcd_model_write_ppm( const char *path );
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,146 @@
+/** \file mixer_test.cpp Sound mixer checks
+ *
+ * Host program that mixes sounds into memory with mixer_render() and
+ * checks the samples: silence, volume, the sum of voices and its
+ * clipping, the end of one-shot sounds, looping and the voice stealing.
+ * The mixer does not touch the hardware, so it needs no register model.
+ *
+ * Usage: mixer_test
+ * It prints each check and returns the number of failed ones.
+ *
+ * Build it with the host compiler:
+ * \verbatim
+   g++ -Iinclude -o mixer_test host/mixer_test.cpp src/mixer.cpp
+   \endverbatim
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <olimex-lpc2378-stk/mixer.h>
+
+/// Silence, the middle of the 10-bit DAC range
+#define SILENCE 512
+
+/// Samples rendered by each check, more than one mixer chunk
+#define LENGTH 200
+
+/// Number of failed checks
+static int failures;
+
+/// Report a check
+static void check( const char *name, int passed )
+{
+    printf( "%-40s %s\n", name, passed ? "ok" : "FAILED" );
+    if( !passed )
+        failures++;
+}
+
+/// Check that every rendered sample has a value
+static int all_equal( const unsigned short *buffer, int count, int value )
+{
+    int i;
+
+    for( i = 0; i < count; i++ )
+        if( buffer[i] != value )
+            return 0;
+
+    return 1;
+}
+
+int main( void )
+{
+    static unsigned short ramp[LENGTH], loud[LENGTH], quiet[LENGTH], low[LENGTH];
+    static unsigned short tick[3] = { 600, 700, 800 };
+    static unsigned short buffer[LENGTH];
+    int i, voice, passed;
+
+    for( i = 0; i < LENGTH; i++ )
+    {
+        ramp[i] = 312 + i;
+        loud[i] = 1000;
+        quiet[i] = 612;
+        low[i] = 100;
+    }
+
+    mixer_initialize();
+    mixer_render( buffer, LENGTH );
+    check( "silence without voices", all_equal( buffer, LENGTH, SILENCE ) );
+
+    voice = mixer_play( ramp, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_render( buffer, LENGTH );
+    passed = voice >= 0;
+    for( i = 0; i < LENGTH; i++ )
+        if( buffer[i] != ramp[i] )
+            passed = 0;
+    check( "full volume plays as recorded", passed );
+    check( "one-shot voice frees at its end", !mixer_active( voice ) );
+
+    mixer_render( buffer, LENGTH );
+    check( "silence after the end", all_equal( buffer, LENGTH, SILENCE ) );
+
+    voice = mixer_play( quiet, LENGTH, MIXER_FULL_VOLUME / 2, 0, 0 );
+    mixer_render( buffer, LENGTH );
+    check( "half volume halves the amplitude", all_equal( buffer, LENGTH, SILENCE + 50 ) );
+
+    mixer_play( quiet, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_play( quiet, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_render( buffer, LENGTH );
+    check( "voices add up", all_equal( buffer, LENGTH, SILENCE + 200 ) );
+
+    mixer_play( loud, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_play( loud, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_render( buffer, LENGTH );
+    check( "high sum clips to 1023", all_equal( buffer, LENGTH, 1023 ) );
+
+    mixer_play( low, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_play( low, LENGTH, MIXER_FULL_VOLUME, 0, 0 );
+    mixer_render( buffer, LENGTH );
+    check( "low sum clips to 0", all_equal( buffer, LENGTH, 0 ) );
+
+    voice = mixer_play( tick, 3, MIXER_FULL_VOLUME, 0, 1 );
+    mixer_render( buffer, LENGTH );
+    passed = mixer_active( voice );
+    for( i = 0; i < LENGTH; i++ )
+        if( buffer[i] != tick[i % 3] )
+            passed = 0;
+    check( "looping voice repeats", passed );
+
+    mixer_stop( voice );
+    mixer_render( buffer, LENGTH );
+    check( "stopped voice is silent", !mixer_active( voice ) &&
+                                      all_equal( buffer, LENGTH, SILENCE ) );
+
+    // The looping voice starts first, then wraps, so its position is the smallest
+    voice = mixer_play( tick, 3, MIXER_FULL_VOLUME, 1, 1 );
+    for( i = 1; i < MIXER_VOICES; i++ )
+        mixer_play( ramp, LENGTH, MIXER_FULL_VOLUME, 1, 0 );
+    mixer_render( buffer, 100 );
+    check( "lower priority cannot steal", mixer_play( ramp, LENGTH, MIXER_FULL_VOLUME, 0, 0 ) < 0 );
+    check( "steals the voice started first", mixer_play( ramp, LENGTH, MIXER_FULL_VOLUME, 1, 0 ) == voice );
+
+    mixer_initialize();
+    for( i = 0; i < MIXER_VOICES; i++ )
+        mixer_play( ramp, LENGTH, MIXER_FULL_VOLUME, i == 2 ? 0 : 1, 0 );
+    check( "steals the lowest priority first", mixer_play( ramp, LENGTH, MIXER_FULL_VOLUME, 1, 0 ) == 2 );
+
+    return failures;
+}
@@ -0,0 +1,112 @@
+/** \file LPC2378.h Host version of the LPC2378 register header
+ *
+ * Replaces the CrossWorks targets/LPC2378.h header to build the library
+ * on a PC. The registers are plain variables, except the ones whose
+ * writes have an effect the LCD controller model in lcd_model.h has to
+ * see: the SSP0 data register, the #CS pin, the GPDMA channel 0 and the
+ * SSP0 interruption mask. Put the host directory first in the include
+ * path so this header is found instead of the CrossWorks one.
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __HOST_LPC2378_H__
+#define __HOST_LPC2378_H__
+
+/// The ARM interruption attribute is dropped, the host has no IRQ mode
+#define interrupt(x)
+
+/// Register whose writes are forwarded to the LCD controller model
+struct hooked_register
+{
+    void (*hook)( unsigned long value ); ///< Called after every write
+    unsigned long value;                 ///< Last value written
+
+    hooked_register &operator=( unsigned long v )
+    {
+        value = v;
+        if( hook ) hook( v );
+        return *this;
+    }
+
+    hooked_register &operator|=( unsigned long v ) { return *this = value | v; }
+    hooked_register &operator&=( unsigned long v ) { return *this = value & v; }
+    operator unsigned long() const { return value; }
+};
+
+// SSP0
+extern hooked_register SSP0DR, SSP0IMSC;
+extern volatile unsigned long SSP0CR0, SSP0CR1, SSP0SR, SSP0CPSR, SSP0RIS, SSP0MIS, SSP0ICR, SSP0DMACR;
+
+// Pins
+extern hooked_register FIO1SET, FIO1CLR;
+extern volatile unsigned long PINSEL1, PINSEL3, PINMODE1, FIO1DIR, FIO3DIR, FIO3SET, FIO3CLR;
+
+// GPDMA
+extern hooked_register DMACC0Configuration;
+extern volatile unsigned long DMACIntStatus, DMACIntTCStatus, DMACIntTCClear, DMACIntErrorStatus,
+                              DMACIntErrClr, DMACConfiguration,
+                              DMACC0SrcAddr, DMACC0DestAddr, DMACC0LLI, DMACC0Control,
+                              DMACC1SrcAddr, DMACC1DestAddr, DMACC1LLI, DMACC1Control,
+                              DMACC1Configuration;
+
+// PWM1 and Timer 0
+extern volatile unsigned long PWM1TCR, PWM1MCR, PWM1PCR, PWM1PR, PWM1MR0, PWM1MR6, PWM1LER;
+extern volatile unsigned long T0TCR, T0MCR, T0PR, T0MR0, T0IR;
+
+// DAC
+extern volatile unsigned long DACR;
+
+// VIC
+extern volatile unsigned long VICIntEnable, VICIntEnClr, VICIntSelect, VICAddress,
+                              VICVectAddr4, VICVectPriority4, VICVectAddr10, VICVectPriority10,
+                              VICVectAddr25, VICVectPriority25;
+
+// System control
+extern volatile unsigned long PCONP, SCS, PLLCON, PLLCFG, PLLSTAT, PLLFEED, CLKSRCSEL,
+                              CCLKCFG, USBCLKCFG, MAMCR, MAMTIM, MEMMAP, PCLKSEL0, PCLKSEL1;
+
+#define SSP0CR1_SSE 0x00000002
+#define SSP0SR_TFE 0x00000001
+#define SSP0SR_TNF 0x00000002
+#define SSP0SR_RNE 0x00000004
+#define SSP0SR_RFF 0x00000008
+#define SSP0SR_BSY 0x00000010
+
+#define PWM1TCR_Counter_Enable 0x00000001
+#define PWM1TCR_Counter_Reset 0x00000002
+#define PWM1TCR_PWM_Enable 0x00000008
+#define PWM1MCR_PWMMR0R 0x00000002
+#define PWM1PCR_PWMENA6 0x00004000
+#define PWM1LER_Enable_PWM_Match_0_Latch 0x00000001
+#define PWM1LER_Enable_PWM_Match_6_Latch 0x00000040
+
+#define T0TCR_Counter_Enable 0x00000001
+#define T0TCR_Counter_Reset 0x00000002
+#define T0MCR_MR0I 0x00000001
+#define T0MCR_MR0R 0x00000002
+#define T0IR_MR0 0x00000001
+
+#define PLLCON_PLLE 0x00000001
+#define PLLCON_PLLC 0x00000002
+#define PLLSTAT_PLOCK 0x04000000
+
+#endif
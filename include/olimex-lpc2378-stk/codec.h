@@ -0,0 +1,80 @@
+/** \file codec.h Compressed sounds
+ *
+ * Decoders for sounds stored in flash as µ-law, 8 bits per sample, or
+ * IMA-ADPCM, 4 bits per sample, instead of the 16 bits of the samples
+ * play_sound() takes. The sounds are decoded a block at a time into a
+ * playback buffer, typically from the refill callback of the sound
+ * playback. tools/wav2snd converts WAV files into compressed sounds.
+ *
+ * A compressed sound is an array of bytes: the format, the sample rate
+ * in Hz in 2 bytes and the number of samples in 4 bytes, both with the
+ * least significant byte first, and then the encoded samples. IMA-ADPCM
+ * samples are packed two per byte, the first one in the low nibble.
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CODEC_H__
+#define __CODEC_H__
+
+#define SOUND_ULAW 1 ///< µ-law sound, 8 bits per sample
+#define SOUND_ADPCM 2 ///< IMA-ADPCM sound, 4 bits per sample
+
+/// Size in bytes of the header of a compressed sound
+#define SOUND_HEADER_SIZE 7
+
+/// State of the decoding of a compressed sound
+struct sound_decoder
+{
+    const unsigned char *data;  ///< Next encoded byte
+    unsigned long remaining;    ///< Samples left to decode
+    unsigned int rate;          ///< Sample rate in Hz
+    int format;                 ///< SOUND_ULAW or SOUND_ADPCM
+    int predictor;              ///< IMA-ADPCM last 16-bit sample
+    int index;                  ///< IMA-ADPCM step index
+    int high_nibble;            ///< IMA-ADPCM: the next sample is in the high nibble
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** Start decoding a compressed sound
+   * \param decoder Decoder
+   * \param sound Compressed sound, with its header
+   * \return 0, or -1 if the format is unknown
+   */
+  int sound_decoder_open( struct sound_decoder *decoder, const unsigned char *sound );
+
+  /** Decode the next samples
+   * \param decoder Decoder
+   * \param samples Where the 10-bit samples for the DAC are written
+   * \param count Number of samples wanted
+   * \return Number of samples decoded, less than count at the end of
+   * the sound, 0 if count is not positive
+   */
+  int sound_decode( struct sound_decoder *decoder, unsigned short *samples, int count );
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+/** \file console.h Text console
+ *
+ * Scrolling text console drawn on the LCD. It keeps a cursor, wraps the
+ * lines, interprets the \\n, \\r, \\t and \\b control characters and
+ * scrolls when the text goes past the last row. The characters are
+ * stored in a cell buffer and only the cells that differ from the ones
+ * on the screen are drawn again.
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+/// Number of columns a tab advances to
+#define CONSOLE_TAB_WIDTH 4
+
+/// Size of the buffer where console_printf() formats its text
+#ifndef CONSOLE_PRINTF_BUFFER
+#define CONSOLE_PRINTF_BUFFER 128
+#endif
+
+/** Text console state
+ * The cell buffers are supplied by the application, rows * columns
+ * characters each, stored row after row from the top row
+ */
+struct console
+{
+    int x;                ///< Smallest X coordinate of the console area
+    int y;                ///< Smallest Y coordinate of the console area
+    int rows;             ///< Number of text rows
+    int columns;          ///< Number of text columns
+    int size;             ///< Font size
+    int color;            ///< Text color
+    int background_color; ///< Background color
+    int row;              ///< Cursor row, 0 for the top one
+    int column;           ///< Cursor column
+    int hardware_scroll;  ///< Scroll with LCD_scroll() instead of redrawing
+    int scrolled;         ///< Lines scrolled by the hardware
+    char *cells;          ///< Characters to show
+    char *shown;          ///< Characters on the screen
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /** Initialize a console and clear its area
+   * The first row is the top one, at the biggest X coordinates.
+   * \param con Console
+   * \param x Smallest X coordinate of the console area
+   * \param y Smallest Y coordinate of the console area
+   * \param rows Number of text rows, reduced to the ones that fit in
+   * the screen
+   * \param columns Number of text columns, reduced to the ones that fit
+   * in the screen
+   * \param size Font size: SMALL_FONT, MEDIUM_FONT or BIG_FONT
+   * \param color Text color
+   * \param background_color Background color
+   * \param cells Buffer of rows * columns characters
+   * \param shown Buffer of rows * columns characters
+   * \param hardware_scroll Scroll with the LCD scroll area, which costs a
+   * single command instead of redrawing the text. It is only used when
+   * the console takes whole lines of the screen: y is 0 and x a multiple
+   * of 4. The scroll area is then set to the console rows
+   */
+  void console_initialize( struct console *con, int x, int y, int rows, int columns,
+                           int size, int color, int background_color,
+                           char *cells, char *shown, int hardware_scroll );
+
+  /// Clear the console and move the cursor to the top left corner
+  void console_clear( struct console *con );
+
+  /** Move the cursor
+   * \param con Console
+   * \param row Row, 0 for the top one
+   * \param column Column
+   */
+  void console_goto( struct console *con, int row, int column );
+
+  /** Write a character at the cursor without updating the screen
+   * \param con Console
+   * \param c Character or \\n, \\r, \\t, \\b control character
+   */
+  void console_put( struct console *con, char c );
+
+  /** Write a string at the cursor and update the screen
+   * \param con Console
+   * \param str String
+   */
+  void console_write( struct console *con, const char *str );
+
+  /** Write formatted text at the cursor and update the screen
+   * The text is cut at CONSOLE_PRINTF_BUFFER - 1 characters.
+   * \param con Console
+   * \param format printf() format
+   * \return Number of characters written
+   */
+  int console_printf( struct console *con, const char *format, ... );
+
+  /// Draw the cells that changed since the last update
+  void console_refresh( struct console *con );
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
@@ -28,4 +28,14 @@
  */
 void initialize_LPC2378( void );
 
+/**
+ * Enable the IRQ interruptions in the processor
+ */
+void enable_IRQ( void );
+
+/**
+ * Enable the FIQ interruptions in the processor
+ */
+void enable_FIQ( void );
+
 #endif
@@ -102,10 +102,39 @@
 #define FILL 1 ///< Fill with the color
 #define NO_FILL 0 ///< Do not fill with the color
 
+#define COLOR_12BIT 12 ///< 4096 colors, 12 bits per pixel
+#define COLOR_8BIT 8 ///< 256 colors, 8 bits per pixel
+
 #define SMALL_FONT 0 ///< Small font size
 #define MEDIUM_FONT 1 ///< Medium font size
 #define BIG_FONT 2 ///< Big font size
 
+#define IMAGE_RAW 0 ///< Image with a 12-bit color per pixel
+#define IMAGE_RLE 1 ///< Run-length encoded image
+
+/// Size in bytes of a framebuffer: 132x132 12-bit pixels, two every three bytes
+#define LCD_FRAMEBUFFER_SIZE ((132 * 132 * 3) / 2)
+
+/// Number of dirty rectangles tracked in framebuffer mode
+#define LCD_DIRTY_RECTANGLES 4
+
+/// Number of screen rows drawn at a time by LCD_record_end()
+#ifndef LCD_BAND_ROWS
+#define LCD_BAND_ROWS 8
+#endif
+
+/// Size in bytes of the band buffer of LCD_record_end()
+#define LCD_BAND_SIZE ((LCD_BAND_ROWS * 132 * 3) / 2)
+
+/** Number of glyphs kept packed by LCD_print_character(), 0 to disable
+ * the glyph cache. Every entry is sized for BIG_FONT and takes 208
+ * bytes of static RAM whatever font is used, so the default costs 832
+ * bytes.
+ */
+#ifndef LCD_GLYPH_CACHE_ENTRIES
+#define LCD_GLYPH_CACHE_ENTRIES 4
+#endif
+
 /** Turn 3 3-bit colors into a 12-bit color
  * \param r Red color [0-7]
  * \param g Green color [0-7]
@@ -113,6 +142,24 @@
  */
 #define RGB_COLOR(r, g, b) ((r<<8) | (g << 4) | b)
 
+/** Proportional font with any set of characters
+ * Each glyph has its own width, the distance to the next one included,
+ * and all of them the same height. The rows of a glyph go from the top
+ * one, each one in (width + 7) / 8 bytes with the leftmost pixel in the
+ * most significant bit. The tools/bdf2lcd converter generates them from
+ * BDF fonts.
+ */
+struct LCD_font
+{
+    unsigned char height;             ///< Rows of the glyphs
+    unsigned short count;             ///< Number of glyphs
+    unsigned short default_glyph;     ///< Glyph drawn for missing characters
+    const unsigned short *codepoints; ///< Unicode codepoint of each glyph, in increasing order
+    const unsigned char *widths;      ///< Width of each glyph
+    const unsigned short *offsets;    ///< Position of each glyph in bitmaps
+    const unsigned char *bitmaps;     ///< Rows of the glyphs
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -146,15 +193,59 @@ extern "C" {
    */
   void LCD_datum( unsigned char datum );
 
+  /** Start a burst transfer to the LCD
+   * The #CS stays asserted until the matching LCD_burst_end(), and the
+   * frames are queued in the SSP0 FIFO without waiting for each one to
+   * be sent. Bursts can be nested.
+   */
+  void LCD_burst_begin( void );
+
+  /** Queue a command inside a burst
+   * \param command Command to send
+   */
+  void LCD_burst_command( unsigned char command );
+
+  /** Queue a datum inside a burst
+   * \param datum Datum to send
+   */
+  void LCD_burst_datum( unsigned char datum );
+
+  /** Queue several data inside a burst
+   * \param data Data to send
+   * \param count Number of data
+   */
+  void LCD_burst_data( const unsigned char *data, unsigned int count );
+
+  /** End a burst transfer
+   * The outermost call waits for the last frame to be sent, empties the
+   * receiving FIFO and deasserts the #CS
+   */
+  void LCD_burst_end( void );
+
   /// Adjust LCD backlight to the maximum
   void LCD_maximum_backlight( void );
 
   /// Turn off LCD backlight
   void LCD_turn_off_backlight( void );
 
-  /// Clear the LCD screen by filling it with white color
+  /// Clear the LCD screen by filling it with white color, within the clip rectangle
   void LCD_clear( void );
 
+  /** Restrict the drawing functions to a rectangle
+   * Every primitive only sends the pixels inside it, and the ones
+   * entirely outside are skipped before sending anything. The rectangle
+   * is limited to the screen, so coordinates out of it no longer wrap
+   * around the controller RAM.
+   * \param x0 X coordinate of a corner of the rectangle
+   * \param y0 Y coordinate of a corner of the rectangle
+   * \param x1 X coordinate of the opposite corner of the rectangle
+   * \param y1 Y coordinate of the opposite corner of the rectangle
+   */
+  void LCD_set_clip( int x0, int y0, int x1, int y1 );
+
+  /// Set the clip rectangle back to the whole screen
+  void LCD_reset_clip( void );
+
   /** Draw a pixel in the LCD screen
    * \param x X coordinate
    * \param y Y coordinate
@@ -163,6 +254,8 @@ extern "C" {
   void LCD_pixel(int x, int y, int color);
 
   /** Draw a line segment using the Bresenham algorithm
+   * The segment is first clipped to the clip rectangle, so only its
+   * visible part is stepped and nothing is sent when none of it is.
    * \param x0 X coordinate of the origin of the segment
    * \param y0 Y coordinate of the origin of the segment
    * \param x1 X coordinate of the end of the segment
@@ -189,7 +282,138 @@ extern "C" {
    */
   void LCD_circumference( int x0, int y0, int radius, int color );
 
+  /** Draw an optionally-filled circle
+   * The filled circle is sent as one window per row.
+   * \param x0 X coordinate of the center
+   * \param y0 Y coordinate of the center
+   * \param radius Radius of the circle
+   * \param fill Fill in the circle: FILL, NO_FILL
+   * \param color Perimeter and fill color
+   */
+  void LCD_circle( int x0, int y0, int radius, unsigned char fill, int color );
+
+  /** Draw an optionally-filled axis-aligned ellipse, one window per span
+   * \param x0 X coordinate of the center
+   * \param y0 Y coordinate of the center
+   * \param x_radius Radius along the X axis
+   * \param y_radius Radius along the Y axis
+   * \param fill Fill in the ellipse: FILL, NO_FILL
+   * \param color Perimeter and fill color
+   */
+  void LCD_ellipse( int x0, int y0, int x_radius, int y_radius, unsigned char fill, int color );
+
+  /** Draw an optionally-filled rectangle with rounded corners, one window
+   * per span
+   * \param x0 X coordinate of a corner of the rectangle
+   * \param y0 Y coordinate of a corner of the rectangle
+   * \param x1 X coordinate of the opposite corner of the rectangle
+   * \param y1 Y coordinate of the opposite corner of the rectangle
+   * \param radius Radius of the corners, reduced to half the rectangle
+   * side if bigger
+   * \param fill Fill in the rectangle: FILL, NO_FILL
+   * \param color Perimeter and fill color
+   */
+  void LCD_rounded_rectangle( int x0, int y0, int x1, int y1, int radius, unsigned char fill, int color );
+
+  /** Draw an image stored as 12-bit colors, through a single window
+   * Nothing is drawn if a corner coordinate is smaller than the first one.
+   * \param x0 X coordinate of a corner of the image
+   * \param y0 Y coordinate of a corner of the image
+   * \param x1 X coordinate of the opposite corner, not smaller than x0
+   * \param y1 Y coordinate of the opposite corner, not smaller than y0
+   * \param pixels Colors, row after row from the smallest X coordinate,
+   * each row from the smallest Y coordinate
+   */
+  void LCD_blit( int x0, int y0, int x1, int y1, const unsigned short *pixels );
+
+  /** Draw an image through a single window, decoding it on the fly
+   * The image is an array of 16-bit words. The first three are its
+   * width (pixels along the Y axis), its height (pixels along the X
+   * axis) and its format, IMAGE_RAW or IMAGE_RLE. The pixels follow, row
+   * after row from the smallest X coordinate, each row from the
+   * smallest Y coordinate:
+   * - IMAGE_RAW: one word per pixel with its 12-bit color.
+   * - IMAGE_RLE: runs of pixels of the same color, which may go on
+   *   across rows. The 12 low bits of a word are the color and the 4
+   *   high bits the length of the run minus 1, up to 14. A value of 15
+   *   means that the length is in the next word. A length of 0 is
+   *   corrupt data, where the drawing stops.
+   *
+   * The tools/ppm2lcd converter generates them from PPM pictures.
+   * \param image Image, usually stored in the flash
+   * \param x X coordinate of the corner with the smallest coordinates
+   * \param y Y coordinate of the corner with the smallest coordinates
+   */
+  void LCD_image( const unsigned short *image, int x, int y );
+
+  /** Draw an image with transparent pixels
+   * Each row is sent as one window per run of opaque pixels.
+   * \param image Image in the format of LCD_image(), at most 132 pixels
+   * wide
+   * \param x X coordinate of the corner with the smallest coordinates
+   * \param y Y coordinate of the corner with the smallest coordinates
+   * \param key_color 12-bit color of the transparent pixels
+   */
+  void LCD_sprite( const unsigned short *image, int x, int y, int key_color );
+
+  /** Print a UTF-8 string with a proportional font
+   * The whole string is sent as a single window, cut at the clip
+   * rectangle.
+   * \param str UTF-8 string
+   * \param x X coordinate
+   * \param y Y coordinate
+   * \param font Font
+   * \param color Character color
+   * \param background_color Background color
+   * \return Number of columns of the window, 0 if the text is outside
+   * the clip rectangle
+   */
+  int LCD_print_text( const char *str, int x, int y, const struct LCD_font *font,
+                      int color, int background_color );
+
+  /** Width of a UTF-8 string printed with a proportional font
+   * \param str UTF-8 string
+   * \param font Font
+   * \return Number of columns
+   */
+  int LCD_text_width( const char *str, const struct LCD_font *font );
+
+  /** Width of the characters of a font
+   * \param size Font size: SMALL_FONT, MEDIUM_FONT or BIG_FONT
+   * \return Pixels along the Y axis
+   */
+  int LCD_font_width( int size );
+
+  /** Height of the characters of a font
+   * \param size Font size: SMALL_FONT, MEDIUM_FONT or BIG_FONT
+   * \return Pixels along the X axis
+   */
+  int LCD_font_height( int size );
+
+  /** Select the color depth of the pixels sent to the LCD
+   * The drawing functions still take 12-bit colors. In 8-bit mode they
+   * are sent as the index of the nearest of the 256 colors of the
+   * palette, one byte per pixel instead of one and a half. The
+   * framebuffer keeps 12-bit pixels, converted by LCD_flush().
+   * \param mode COLOR_12BIT or COLOR_8BIT
+   */
+  void LCD_color_mode( unsigned char mode );
+
+  /** Load the palette of the 8-bit color mode through RGBSET8
+   * The 256 colors are the combinations of 8 red, 8 green and 4 blue
+   * levels, with RRRGGGBB indexes. The default palette spreads the
+   * levels evenly.
+   * \param red 8 red levels [0-15], from index 0 to 7
+   * \param green 8 green levels [0-15], from index 0 to 7
+   * \param blue 4 blue levels [0-15], from index 0 to 3
+   */
+  void LCD_set_palette( const unsigned char *red, const unsigned char *green, const unsigned char *blue );
+
   /** Print a character in the LCD screen
+   * The glyph is packed with its colors into a small cache, with the
+   * least recently used entry replaced, so printing it again with the
+   * same colors just streams the cached data. Characters outside the
+   * font, which covers 0x20 to 0x7F, are printed as '?'.
    * \param c Character
    * \param x X coordinate
    * \param y Y coordinate
@@ -200,9 +424,9 @@ extern "C" {
   void LCD_print_character( char c, int x, int y, int size, int color, int background_color );
 
   /** Print a string in the LCD screen
-   * Specifically, it iterates over the string printing each character
-   * with the LCD_print_character() function and updating the printing
-   * coordinate.
+   * The whole string is sent as a single window, cut at the clip
+   * rectangle. The glyph cache is only used when all the different
+   * characters drawn fit in it at once.
    * \param str String pointer
    * \param x X coordinate
    * \param y Y coordinate
@@ -212,6 +436,193 @@ extern "C" {
    */
   void LCD_print_string( char *str, int x, int y, int size, int color, int background_color );
 
+  /** Enable the framebuffer mode
+   * From then on, the drawing functions render into RAM and record the
+   * modified regions, and the screen is only updated by LCD_flush().
+   * The buffer contents are kept, so call LCD_clear() if the buffer
+   * does not hold a copy of the screen yet.
+   * \param buffer LCD_FRAMEBUFFER_SIZE bytes where the rows of the screen
+   * are stored one after another, with the 12-bit pixels packed two
+   * every three bytes in the same format the controller receives them
+   */
+  void LCD_framebuffer_enable( unsigned char *buffer );
+
+  /** Enable the double buffer mode
+   * The drawing functions render into the buffer as in framebuffer mode,
+   * and LCD_swap() sends only the pixels that differ from a copy of the
+   * screen. It suits screens redrawn whole each time, where most pixels
+   * do not change. The whole screen is sent on the first swap.
+   * \param buffer LCD_FRAMEBUFFER_SIZE bytes where the drawing functions
+   * render, in the format of LCD_framebuffer_enable()
+   * \param copy LCD_FRAMEBUFFER_SIZE bytes for the copy of the screen
+   */
+  void LCD_double_buffer_enable( unsigned char *buffer, unsigned char *copy );
+
+  /** Send the pixels that changed since the last swap
+   * The rows drawn since then are compared 4 bytes at a time with the
+   * copy of the screen, and each changed span of a row is sent in its
+   * own window. Equal runs shorter than the cost of a new window are
+   * sent along with the span.
+   * \return Bytes sent to the controller, commands included, to help
+   * tune the screens. 0 if the double buffer mode is not enabled
+   */
+  unsigned long LCD_swap( void );
+
+  /** Flush the framebuffer and go back to drawing directly on the screen
+   * This also leaves the double buffer mode
+   */
+  void LCD_framebuffer_disable( void );
+
+  /** Send the framebuffer regions modified since the last flush to the
+   * screen, with one window per dirty rectangle. In double buffer mode
+   * it is the same as LCD_swap()
+   */
+  void LCD_flush( void );
+
+  /** Start recording the drawing functions into a display list
+   * From then on, the drawing and clipping functions only store their
+   * arguments, and nothing is drawn until LCD_record_end(). Strings are
+   * copied, but images, fonts and DMA frames are referenced, so they
+   * must stay valid until then. LCD_print_text() returns 0 while
+   * recording.
+   * \param list Buffer where the entries are stored
+   * \param size Size of the buffer in bytes
+   */
+  void LCD_record_begin( unsigned char *list, unsigned int size );
+
+  /** Stop recording and draw the display list
+   * Without a framebuffer, the screen is drawn in bands of LCD_BAND_ROWS
+   * rows: each band is filled with the background color, every entry is
+   * drawn clipped to it and the band is sent in a single window. The
+   * list thus describes the whole screen, with far less RAM than a
+   * framebuffer. Each band only draws the entries that reach its rows.
+   * In framebuffer mode the entries are simply drawn into
+   * the framebuffer.
+   * \param band LCD_BAND_SIZE bytes used to draw the bands
+   * \param background_color Color of the pixels no entry draws
+   * \return 0, or -1 if some entries were dropped: the list buffer
+   * overflowed, or an LCD_dma_blit() had more than 65535 frames
+   */
+  int LCD_record_end( unsigned char *band, int background_color );
+
+  /** Define the area scrolled by LCD_scroll()
+   * The controller scrolls blocks of 4 lines (page addresses), so the
+   * area is widened to whole blocks. The lines above and below it stay
+   * fixed. The scroll offset is reset.
+   * \param top First line of the area
+   * \param bottom Last line of the area
+   */
+  void LCD_scroll_area( int top, int bottom );
+
+  /** Scroll the contents of the scroll area with SCSTART
+   * Only the display start changes, so scrolling costs one command and
+   * the application just draws the lines that come into view.
+   * \param lines Lines scrolled from the original position, rounded
+   * down to a multiple of 4. The lines leaving the area at the top come
+   * back at its bottom
+   */
+  void LCD_scroll( int lines );
+
+  /** Translate a displayed row into the line to draw on after scrolling
+   * \param x Row as seen on the screen
+   * \return Line (page address) shown in that row
+   */
+  int LCD_scroll_row( int x );
+
+  /** Enable the GPDMA transfers to the LCD
+   * Large solid fills, like LCD_clear() and filled rectangles, are then
+   * sent by the GPDMA channel 0 while the drawing function returns. Any
+   * later access to the LCD waits for the transfer to end.
+   * The IRQs are enabled, since the transfers are driven by the GPDMA
+   * interruption.
+   * \param buffer Buffer for the fill patterns. The GPDMA cannot access
+   * the local SRAM nor the flash, so it must be placed in the USB or
+   * Ethernet RAM
+   * \param size Number of 16-bit frames that fit in the buffer, at
+   * least 3. Bigger buffers mean fewer interruptions for colored fills
+   */
+  void LCD_dma_enable( unsigned short *buffer, unsigned int size );
+
+  /// Wait for the current transfer and go back to CPU transfers
+  void LCD_dma_disable( void );
+
+  /** Set a function to be called when a DMA transfer ends
+   * \param callback Function, called from the GPDMA interruption, or
+   * NULL for none
+   */
+  void LCD_dma_callback( void (*callback)( void ) );
+
+  /// Check if a DMA transfer is in progress
+  int LCD_dma_busy( void );
+
+  /// Wait for the current DMA transfer to end
+  void LCD_dma_wait( void );
+
+  /** Send an image to a window of the LCD through the DMA
+   * The function returns as soon as the transfer starts, so the next
+   * line of an image can be prepared in another buffer meanwhile.
+   * Without DMA, or in framebuffer mode, the frames are decoded and
+   * drawn by the CPU.
+   * \param x0 X coordinate of a corner of the window
+   * \param y0 Y coordinate of a corner of the window
+   * \param x1 X coordinate of the opposite corner of the window
+   * \param y1 Y coordinate of the opposite corner of the window
+   * \param frames Pixels packed by LCD_dma_pack() in the current color
+   * mode, in memory reachable by the GPDMA. It must not change until the
+   * transfer ends
+   * \param count Number of frames, a multiple of 3 in 12-bit color mode
+   */
+  void LCD_dma_blit( int x0, int y0, int x1, int y1, const unsigned short *frames, unsigned int count );
+
+  /** Pack 12-bit pixels into the 9-bit frames sent to the LCD
+   * In 8-bit color mode each pixel takes a single frame.
+   * \param frames Destination, with room for 3 frames every 2 pixels
+   * \param pixels 12-bit colors
+   * \param count Number of pixels
+   * \return Number of frames written
+   */
+  unsigned int LCD_dma_pack( unsigned short *frames, const unsigned short *pixels, unsigned int count );
+
+  /** Enable the interrupt-driven transmit queue
+   * From then on, the frames sent to the LCD are stored in a ring buffer
+   * emptied by the SSP0 interruption, so drawing functions return as
+   * soon as their frames are queued. When the queue is full they wait
+   * for room, which requires the IRQs to be enabled; LCD_queue_free()
+   * lets the application avoid that.
+   * The #CS stays asserted while the queue is enabled, and GPDMA fills
+   * wait for the queue to be empty before starting.
+   * \param buffer Ring buffer of 9-bit frames
+   * \param size Number of frames that fit in the buffer
+   */
+  void LCD_queue_enable( unsigned short *buffer, unsigned int size );
+
+  /// Wait for the queue to be empty and go back to synchronous transfers
+  void LCD_queue_disable( void );
+
+  /// Wait until every frame queued or in a DMA transfer has been sent
+  void LCD_wait_idle( void );
+
+  /// Number of frames that can be queued without waiting
+  unsigned int LCD_queue_free( void );
+
+  /// Maximum number of frames queued since the last statistics reset
+  unsigned int LCD_queue_high_water_mark( void );
+
+  /// Number of times a frame had to wait for room in the queue
+  unsigned long LCD_queue_stalls( void );
+
+  /// Reset the queue high-water mark and stall count
+  void LCD_queue_reset_statistics( void );
+
+  /** Get the glyph cache statistics since the last LCD_glyph_cache_clear()
+   * \param hits Number of glyphs found in the cache
+   * \param misses Number of glyphs that had to be packed
+   */
+  void LCD_glyph_cache_statistics( unsigned long *hits, unsigned long *misses );
+
+  /// Empty the glyph cache and reset its statistics
+  void LCD_glyph_cache_clear( void );
+
   /// Function to generate delays by software
   void delay( volatile unsigned int t );
 
@@ -0,0 +1,114 @@
+/** \file mixer.h Sound mixer
+ *
+ * Mixes several sounds into one stream for the DAC. Each voice plays a
+ * sound at its own volume, once or looping, and a new sound takes a free
+ * voice or steals the one with the lowest priority.
+ *
+ * The mixer does not touch the hardware: mixer_render() mixes a block
+ * of samples into a buffer, typically from the refill callback of the
+ * sound playback, so the timer interruption only copies samples. It
+ * also builds on the host, where host/mixer_test.cpp checks it by mixing
+ * into memory. With a loop of two buffers:
+ * \verbatim
+   static unsigned short block[2][256];
+   static struct sound_link links[2];
+   static int ended;
+
+   static void refill( void )
+   {
+       mixer_render( block[ended], 256 );
+       ended ^= 1;
+   }
+
+   links[0].samples = block[0]; links[0].count = 256; links[0].next = &links[1];
+   links[1].samples = block[1]; links[1].count = 256; links[1].next = &links[0];
+   mixer_render( block[0], 256 );
+   mixer_render( block[1], 256 );
+   sound_refill_callback( refill, 1 );
+   play_sound_chain( &links[0] );
+   \endverbatim
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __MIXER_H__
+#define __MIXER_H__
+
+/// Number of sounds that can play at the same time
+#ifndef MIXER_VOICES
+#define MIXER_VOICES 4
+#endif
+
+/// Volume at which a sound plays as recorded
+#define MIXER_FULL_VOLUME 256
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  /// Stop every voice
+  void mixer_initialize( void );
+
+  /** Play a sound on a voice
+   * A free voice is taken if there is one. Otherwise the voice with the
+   * lowest priority is stolen, as long as it is not above the priority
+   * of the new sound, and among equal ones the voice started first,
+   * looping or not.
+   * \param samples 10-bit samples, as for play_sound()
+   * \param count Number of samples
+   * \param volume Volume, MIXER_FULL_VOLUME to play the sound as recorded
+   * \param priority Priority, the bigger the more important
+   * \param loop 1 to repeat the sound until mixer_stop() is called
+   * \return Voice number, or -1 if every voice has a bigger priority
+   */
+  int mixer_play( const unsigned short *samples, int count, int volume, int priority, int loop );
+
+  /** Stop a voice
+   * \param voice Voice number
+   */
+  void mixer_stop( int voice );
+
+  /** Change the volume of a voice
+   * \param voice Voice number
+   * \param volume Volume, MIXER_FULL_VOLUME to play the sound as recorded
+   */
+  void mixer_volume( int voice, int volume );
+
+  /** Check if a voice is playing
+   * \param voice Voice number
+   * \return 1 if it is playing, 0 if it is free
+   */
+  int mixer_active( int voice );
+
+  /** Mix the next samples of every voice
+   * The sum is clipped to the DAC range. Silence is rendered when no
+   * voice plays. It is not reentrant: call it from one place only,
+   * typically the refill callback.
+   * \param buffer Where the 10-bit samples are written
+   * \param count Number of samples
+   */
+  void mixer_render( unsigned short *buffer, int count );
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
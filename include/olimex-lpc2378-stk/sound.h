@@ -23,9 +23,33 @@
 #ifndef __SOUND_H__
 #define __SOUND_H__
 
-/// Initialize sound playback
+/// Number of buffers the playback queue holds, the one playing included
+#ifndef SOUND_QUEUE_BUFFERS
+#define SOUND_QUEUE_BUFFERS 4
+#endif
+
+/// Buffer of samples in a chain played by play_sound_chain()
+struct sound_link
+{
+  const unsigned short *samples; ///< Samples
+  int count;                     ///< Number of samples
+  struct sound_link *next;       ///< Next buffer, 0 at the end of the chain
+};
+
+/// Initialize sound playback at 8 kHz
 void initialize_sound_playback( void );
 
+/** \brief Initialize sound playback at a sample rate
+ *
+ * The Timer 0 period is computed from the peripheral clock set up by
+ * initialize_LPC2378(), or any other clock settings in effect, so it
+ * has to be called after changing them. The period is a whole number
+ * of PCLK cycles, so the rate achieved may differ slightly.
+ * \param rate sample rate in Hz, e.g. 8000, 11025, 16000 or 22050
+ * \return rate achieved in Hz, 0 if rate is 0
+ */
+unsigned long initialize_sound_playback_rate ( unsigned long rate );
+
 /** \brief Play a sound
  *
  * Given by an array of samples and the number of samples
@@ -39,4 +63,73 @@ void initialize_sound_playback( void );
  */
 void play_sound ( const unsigned short *sptr, int samples );
 
+/** \brief Queue a buffer of samples to stream
+ *
+ * The buffer plays right after the ones already queued, with no gap
+ * between them, and playback starts if it was stopped. Until
+ * finish_sound() is called, the queue running dry counts as an underrun
+ * and the DAC holds the last sample until a buffer is queued.
+ *
+ * The buffer must stay valid until it has been played.
+ * \param sptr samples array pointer
+ * \param samples number of samples
+ * \return 1 if queued, 0 if the queue is full
+ */
+int queue_sound ( const unsigned short *sptr, int samples );
+
+/** \brief Play a chain of linked buffers
+ *
+ * The buffers play one after another without gaps, following the next
+ * pointers, until one of them is 0. A chain that loops back plays until
+ * stop_sound() is called, with no work for the application, and the
+ * buffers can be refilled from the refill callback, which is called at
+ * the end of each one.
+ * \param first first buffer of the chain
+ */
+void play_sound_chain ( struct sound_link *first );
+
+/** \brief Play the samples from a fast interruption
+ *
+ * Routes the Timer 0 interruption to the FIQ, which skips the vectored
+ * IRQ entry and exit of every sample and leaves the IRQs for the rest
+ * of the application. The startup code must branch to fiq_handler(),
+ * as the CrossWorks one does, and nothing else may use the FIQ.
+ *
+ * The refill callback then runs in FIQ mode too, on the FIQ stack, and
+ * so do mixer_render() or sound_decode() when it calls them. Startup
+ * files often give the FIQ mode no stack at all, so set its size in
+ * the project for the handler plus the callback and everything it
+ * calls, as for the IRQ stack.
+ *
+ * The LPC23xx GPDMA cannot be paced by the timers or the DAC, so this
+ * is the cheapest way to feed the DAC at a steady rate.
+ * \param enable 1 to use the FIQ, 0 to go back to the IRQ
+ */
+void sound_fast_interrupt ( int enable );
+
+/// Stop the stream when the queued buffers end, without an underrun
+void finish_sound ( void );
+
+/// Stop the playback at once and empty the queue
+void stop_sound ( void );
+
+/** \brief Set the function that refills the queue
+ *
+ * It is called from the timer interruption, the FIQ if
+ * sound_fast_interrupt() is enabled, when a buffer ends and at most
+ * low_watermark buffers are left, so it must be short: typically
+ * it fills the ended buffer and queues it again. With two buffers and a
+ * low watermark of 1 this is ping-pong playback.
+ * \param callback function, or 0 for none
+ * \param low_watermark queued buffers, the playing one included, at
+ * or below which the callback is called
+ */
+void sound_refill_callback ( void (*callback)( void ), int low_watermark );
+
+/// Number of queued buffers, the one playing included
+int sound_buffers_queued ( void );
+
+/// Number of times the queue ran dry while streaming
+unsigned long sound_underruns ( void );
+
 #endif
@@ -0,0 +1,139 @@
+/// \file codec.cpp Compressed sounds
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <olimex-lpc2378-stk/codec.h>
+
+/// IMA-ADPCM quantizer step sizes
+static const unsigned short adpcm_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+
+/// IMA-ADPCM step index change for each code magnitude
+static const signed char adpcm_index_changes[8] = {
+    -1, -1, -1, -1, 2, 4, 6, 8
+    };
+
+/// Convert a 16-bit signed sample to the 10-bit DAC range
+static inline unsigned short dac_sample( int sample )
+{
+    return (unsigned short)((sample + 32768) >> 6);
+}
+
+/// Expand a µ-law code to a 16-bit signed sample
+static inline int ulaw_sample( unsigned char code )
+{
+    int exponent, sample;
+
+    code = ~code;
+    exponent = (code >> 4) & 7;
+    sample = ((((code & 0x0F) << 3) + 0x84) << exponent) - 0x84;
+
+    return (code & 0x80) ? -sample : sample;
+}
+
+/// Decode an IMA-ADPCM code, updating the predictor and step index
+static inline int adpcm_sample( struct sound_decoder *decoder, int code )
+{
+    int step = adpcm_steps[decoder->index];
+    int difference = step >> 3;
+
+    if( code & 4 ) difference += step;
+    if( code & 2 ) difference += step >> 1;
+    if( code & 1 ) difference += step >> 2;
+
+    if( code & 8 )
+    {
+        decoder->predictor -= difference;
+        if( decoder->predictor < -32768 ) decoder->predictor = -32768;
+    }
+    else
+    {
+        decoder->predictor += difference;
+        if( decoder->predictor > 32767 ) decoder->predictor = 32767;
+    }
+
+    decoder->index += adpcm_index_changes[code & 7];
+    if( decoder->index < 0 ) decoder->index = 0;
+    if( decoder->index > 88 ) decoder->index = 88;
+
+    return decoder->predictor;
+}
+
+int sound_decoder_open( struct sound_decoder *decoder, const unsigned char *sound )
+{
+    decoder->format = sound[0];
+    decoder->rate = sound[1] | (sound[2] << 8);
+    decoder->remaining = (unsigned long)sound[3] | ((unsigned long)sound[4] << 8) |
+                         ((unsigned long)sound[5] << 16) | ((unsigned long)sound[6] << 24);
+    decoder->data = sound + SOUND_HEADER_SIZE;
+    decoder->predictor = 0;
+    decoder->index = 0;
+    decoder->high_nibble = 0;
+
+    if( decoder->format != SOUND_ULAW && decoder->format != SOUND_ADPCM )
+    {
+        decoder->remaining = 0;
+        return -1;
+    }
+
+    return 0;
+}
+
+int sound_decode( struct sound_decoder *decoder, unsigned short *samples, int count )
+{
+    const unsigned char *data = decoder->data;
+    int i;
+
+    if( count <= 0 )
+        return 0;
+
+    if( (unsigned long)count > decoder->remaining )
+        count = decoder->remaining;
+
+    if( decoder->format == SOUND_ULAW )
+    {
+        for( i = 0; i < count; i++ )
+            samples[i] = dac_sample( ulaw_sample( *data++ ) );
+    }
+    else
+    {
+        for( i = 0; i < count; i++ )
+        {
+            if( decoder->high_nibble )
+                samples[i] = dac_sample( adpcm_sample( decoder, *data++ >> 4 ) );
+            else
+                samples[i] = dac_sample( adpcm_sample( decoder, *data & 0x0F ) );
+
+            decoder->high_nibble = !decoder->high_nibble;
+        }
+    }
+
+    decoder->data = data;
+    decoder->remaining -= count;
+
+    return count;
+}
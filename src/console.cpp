@@ -0,0 +1,234 @@
+/// \file console.cpp Text console
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <olimex-lpc2378-stk/lcd.h>
+#include <olimex-lpc2378-stk/console.h>
+
+/// Line where a text row is drawn, after the hardware scroll
+static int row_line( struct console *con, int row )
+{
+    int x = con->x + (con->rows - 1 - row) * LCD_font_height( con->size );
+
+    return con->hardware_scroll ? LCD_scroll_row( x ) : x;
+}
+
+/// Move the text one row up and blank the last row
+static void scroll_up( struct console *con )
+{
+    int last = (con->rows - 1) * con->columns;
+
+    memmove( con->cells, con->cells + con->columns, last );
+    memset( con->cells + last, ' ', con->columns );
+
+    if( con->hardware_scroll )
+    {
+        /* The screen rows move up too, with the top one coming back at
+         * the bottom, so the cells on the screen move the same way
+         */
+        char top[132];
+
+        memcpy( top, con->shown, con->columns );
+        memmove( con->shown, con->shown + con->columns, last );
+        memcpy( con->shown + last, top, con->columns );
+
+        con->scrolled -= LCD_font_height( con->size );
+        LCD_scroll( con->scrolled );
+    }
+}
+
+/// Move the cursor to the start of the next row, scrolling at the end
+static void new_line( struct console *con )
+{
+    con->column = 0;
+
+    if( ++con->row == con->rows )
+    {
+        scroll_up( con );
+        con->row = con->rows - 1;
+    }
+}
+
+void console_initialize( struct console *con, int x, int y, int rows, int columns,
+                         int size, int color, int background_color,
+                         char *cells, char *shown, int hardware_scroll )
+{
+    int height, width;
+
+    if( !LCD_font_width( size ) ) size = SMALL_FONT;
+    height = LCD_font_height( size );
+    width = LCD_font_width( size );
+
+    // The console must fit in the screen, which also bounds the row copies
+    if( x < 0 ) x = 0;
+    if( y < 0 ) y = 0;
+    if( rows > (132 - x) / height ) rows = (132 - x) / height;
+    if( columns > (132 - y) / width ) columns = (132 - y) / width;
+    if( rows < 1 ) rows = 1;
+    if( columns < 1 ) columns = 1;
+
+    height *= rows;
+
+    con->x = x;
+    con->y = y;
+    con->rows = rows;
+    con->columns = columns;
+    con->size = size;
+    con->color = color;
+    con->background_color = background_color;
+    con->cells = cells;
+    con->shown = shown;
+    con->scrolled = 0;
+
+    // The hardware scrolls whole lines in blocks of 4
+    con->hardware_scroll = hardware_scroll && y == 0 && (x & 3) == 0;
+
+    if( con->hardware_scroll )
+    {
+        LCD_scroll_area( x, x + height - 1 );
+        LCD_rectangle( x, 0, x + height - 1, 131, FILL, background_color );
+    }
+    else
+        LCD_rectangle( x, y, x + height - 1,
+                       y + columns * width - 1, FILL, background_color );
+
+    memset( shown, ' ', rows * columns );
+    console_clear( con );
+}
+
+void console_clear( struct console *con )
+{
+    memset( con->cells, ' ', con->rows * con->columns );
+    con->row = 0;
+    con->column = 0;
+
+    console_refresh( con );
+}
+
+void console_goto( struct console *con, int row, int column )
+{
+    if( row < 0 ) row = 0;
+    if( row >= con->rows ) row = con->rows - 1;
+    if( column < 0 ) column = 0;
+    if( column >= con->columns ) column = con->columns - 1;
+
+    con->row = row;
+    con->column = column;
+}
+
+void console_put( struct console *con, char c )
+{
+    switch( c )
+    {
+    case '\n':
+        new_line( con );
+        return;
+
+    case '\r':
+        con->column = 0;
+        return;
+
+    case '\b':
+        if( con->column > 0 )
+            con->column--;
+        return;
+
+    case '\t':
+        do
+            console_put( con, ' ' );
+        while( con->column % CONSOLE_TAB_WIDTH && con->column < con->columns );
+        return;
+    }
+
+    // Only the characters in the font are printed
+    if( (unsigned char)c < ' ' || (unsigned char)c > 0x7F )
+        return;
+
+    // The line wraps when a character does not fit in it
+    if( con->column == con->columns )
+        new_line( con );
+
+    con->cells[con->row * con->columns + con->column++] = c;
+}
+
+void console_write( struct console *con, const char *str )
+{
+    while( *str )
+        console_put( con, *str++ );
+
+    console_refresh( con );
+}
+
+int console_printf( struct console *con, const char *format, ... )
+{
+    char text[CONSOLE_PRINTF_BUFFER];
+    va_list args;
+    int length;
+
+    va_start( args, format );
+    length = vsnprintf( text, sizeof text, format, args );
+    va_end( args );
+
+    console_write( con, text );
+
+    return (length < (int)sizeof text) ? length : (int)sizeof text - 1;
+}
+
+void console_refresh( struct console *con )
+{
+    char run[132 / 6 + 1];
+    int row, column, start, width;
+    char *cells, *shown;
+
+    width = LCD_font_width( con->size );
+
+    for( row = 0; row < con->rows; row++ )
+    {
+        cells = con->cells + row * con->columns;
+        shown = con->shown + row * con->columns;
+
+        // Each run of changed cells is printed as one string
+        column = 0;
+        while( column < con->columns )
+        {
+            if( cells[column] == shown[column] )
+            {
+                column++;
+                continue;
+            }
+
+            start = column;
+            while( column < con->columns && cells[column] != shown[column] &&
+                   column - start < (int)sizeof run - 1 )
+                column++;
+
+            memcpy( run, cells + start, column - start );
+            run[column - start] = 0;
+            memcpy( shown + start, cells + start, column - start );
+
+            LCD_print_string( run, row_line( con, row ), con->y + start * width,
+                              con->size, con->color, con->background_color );
+        }
+    }
+}
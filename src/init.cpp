@@ -98,3 +98,21 @@ void initialize_LPC2378(void)
 #endif
 
 }
+
+void enable_IRQ( void )
+{
+	asm ("stmfd sp!,{r0}");
+	asm ("mrs  r0,CPSR");
+	asm ("bic  r0,r0,#0x80");
+	asm ("msr  CPSR_c,r0");
+	asm ("ldmfd sp!,{r0}");
+}
+
+void enable_FIQ( void )
+{
+	asm ("stmfd sp!,{r0}");
+	asm ("mrs  r0,CPSR");
+	asm ("bic  r0,r0,#0x40");
+	asm ("msr  CPSR_c,r0");
+	asm ("ldmfd sp!,{r0}");
+}
@@ -1,4 +1,11 @@
-/// \file lcd.cpp LCD functions
+/** \file lcd.cpp LCD functions
+ *
+ * \warning If the Philips_LPC230X_Startup.s file provided by
+ * CrossStudio is being used, the interruption function declarations
+ * should only include the attribute\n\n
+ *         __attribute__ ((interrupt ("IRQ")))\n\n
+ * if the symbol VECTORED_IRQ_INTERRUPTS has been defined.
+ */
 
 /* Copyright 2008 Victor Manuel Sánchez Corbacho.
  * Copyright 2012 Diego Barrios Romero.
@@ -20,466 +27,3029 @@
  * <http://www.gnu.org/licenses/>.
  */
 
+#include <stdarg.h>
+#include <string.h>
 #include <targets/LPC2378.h>
+#include <olimex-lpc2378-stk/init.h>
 #include <olimex-lpc2378-stk/lcd.h>
 #include <olimex-lpc2378-stk/fonts.h>
 
-void initialize_SSP0( void )
-{
-  unsigned int i, dummy;
+/// Bytes in a framebuffer row: 132 12-bit pixels
+#define FRAMEBUFFER_ROW ((132 * 3) / 2)
 
-  // Assign pins to SCK0, MOSI0 and MISO0
-  PINSEL3 |= (3<<16) | (3<<14) | (3<<8);
+/// Bytes of the biggest packed glyph: 16 rows of 8 pixels
+#define GLYPH_BYTES ((16 * 8 * 3) / 2)
 
-  // The P1.21 pin controls the #CS signal of the LCD.
-  // Set the pin as output
-  FIO1DIR |= 1<<21;
+/// Fills shorter than this number of pixel pairs are not worth a DMA transfer
+#define DMA_MINIMUM_PAIRS 64
 
-  // Deactivate the #CS
-  LCD_CS_1;
+/// Maximum transfer size of a GPDMA channel
+#define DMA_MAXIMUM_TRANSFER 4095
 
-  // Set up power for the SSP0 module
-  PCONP |= 1<<21;
+/// GPDMA transfer end routine
+void ISR_GPDMA( void ) __attribute__ ((interrupt ("IRQ")));
+/// Transmit queue service routine
+void ISR_SSP0( void ) __attribute__ ((interrupt ("IRQ")));
 
-  // Configuration
+/// Rectangle in screen coordinates, limits included
+struct rectangle
+{
+    int x0, y0, x1, y1;
+};
 
-  SSP0CR1 = 0;
-  SSP0IMSC = 0;
-  SSP0DMACR = 0;
-  SSP0CPSR = 8; // SSP0 clock divider
-  SSP0CR0 = (9-1);
-  SSP0CR1 |= SSP0CR1_SSE; // Enable SSP0
+/// Framebuffer where the primitives draw, NULL when drawing on the screen
+static unsigned char *framebuffer;
 
-  // Empty the receiving buffer
-  for (i = 0; i < 8; i++ )  dummy = SSP0DR;
-}
+/// Rows of the screen held by the framebuffer, a band of them while rendering a display list
+static int framebuffer_x0, framebuffer_x1 = 131;
 
-void LCD_initialize_pwm_backlight( void )
-{
-  PINSEL3 = (PINSEL3 & ~(3<<20)) | 2<<20;
-  PCONP |= 1<<6;
-  PWM1TCR = PWM1TCR_Counter_Reset;
+/// Copy of the screen in double buffer mode, NULL otherwise
+static unsigned char *shown;
 
-  PWM1MCR = PWM1MCR_PWMMR0R;
-  PWM1PCR = PWM1PCR_PWMENA6;
+/// The copy of the screen is up to date, otherwise LCD_swap() sends it all
+static int shown_valid;
 
-  PWM1PR = 0;
-  PWM1MR0 = 0xFF;
-  PWM1LER |= PWM1LER_Enable_PWM_Match_0_Latch;
-  PWM1MR6 = 0;
-  PWM1LER |= PWM1LER_Enable_PWM_Match_6_Latch;
-  PWM1TCR |= PWM1TCR_PWM_Enable;
-  PWM1TCR &= ~PWM1TCR_Counter_Reset;
-  PWM1TCR |= PWM1TCR_Counter_Enable;
+/** Longest run of equal words LCD_swap() sends rather than skips: a new
+ * window costs 7 bytes of commands
+ */
+#define SWAP_GAP_WORDS 2
 
-  LCD_adjust_backlight( 0 ); /// Initially off
-}
+/// Clip rectangle, always inside the screen
+static struct rectangle clip = { 0, 0, 131, 131 };
 
-void LCD_adjust_backlight( unsigned char intensity )
+/// Regions of the framebuffer modified since the last LCD_flush()
+static struct rectangle dirty[LCD_DIRTY_RECTANGLES];
+
+/// Number of valid entries in dirty
+static int dirty_count;
+
+/// Nesting level of LCD_burst_begin() calls
+static int burst_depth;
+
+/// Display list operations, one for each recorded drawing function
+enum
 {
-  PWM1MR6 = intensity;
-  PWM1LER |= PWM1LER_Enable_PWM_Match_6_Latch;
+    LIST_CLEAR,
+    LIST_PIXEL,
+    LIST_LINE,
+    LIST_RECTANGLE,
+    LIST_CIRCUMFERENCE,
+    LIST_CIRCLE,
+    LIST_ELLIPSE,
+    LIST_ROUNDED_RECTANGLE,
+    LIST_CHARACTER,
+    LIST_STRING,
+    LIST_TEXT,
+    LIST_BLIT,
+    LIST_IMAGE,
+    LIST_SPRITE,
+    LIST_DMA_BLIT,
+    LIST_CLIP
+};
+
+/// Number of 16-bit arguments of each display list operation
+static const unsigned char list_arguments[] = {
+    0, 3, 5, 6, 4, 5, 6, 7, 6, 5, 4, 4, 2, 3, 5, 4
+    };
+
+/** Display list state
+ * Each entry is an operation byte followed by its 16-bit arguments and,
+ * for some operations, a pointer and a string
+ */
+static struct
+{
+    unsigned char *buffer;   ///< Entries, NULL when not recording
+    unsigned int size;       ///< Size of the buffer
+    unsigned int length;     ///< Bytes used
+    unsigned int entry;      ///< Start of the entry being recorded
+    int dropped;             ///< The entry being recorded did not fit
+    int overflow;            ///< Some entry did not fit
+    int replaying;           ///< The entries are being drawn
+    struct rectangle clip;   ///< Clip rectangle when the recording began
+    struct rectangle last_clip; ///< Clip rectangle set by the entries
+} display_list;
+
+/// Append data to the entry being recorded, dropping it if it does not fit
+static void list_put( const void *data, unsigned int size )
+{
+    if( display_list.dropped ) return;
+
+    if( display_list.length + size > display_list.size )
+    {
+        display_list.length = display_list.entry;
+        display_list.dropped = 1;
+        display_list.overflow = 1;
+        return;
+    }
+
+    memcpy( display_list.buffer + display_list.length, data, size );
+    display_list.length += size;
 }
 
-void LCD_command( unsigned char command )
+/** Record a drawing function call with its integer arguments
+ * \return 1 if the call was recorded, 0 if it has to be drawn
+ */
+static int record( int operation, ... )
 {
-  volatile unsigned char dummy;
+    va_list args;
+    unsigned char op = operation;
+    short value;
+    int i;
 
-  LCD_CS_0;
+    if( !display_list.buffer || display_list.replaying ) return 0;
 
-  while( !(SSP0SR & SSP0SR_TNF) );
-  SSP0DR = command & 0xFF;
-  while( SSP0SR & SSP0SR_BSY );
-  dummy = SSP0DR;
+    display_list.entry = display_list.length;
+    display_list.dropped = 0;
+    list_put( &op, 1 );
 
-  LCD_CS_1;
+    va_start( args, operation );
+    for( i = 0; i < list_arguments[operation]; i++ )
+    {
+        value = va_arg( args, int );
+        list_put( &value, sizeof value );
+    }
+    va_end( args );
+
+    return 1;
 }
 
-void LCD_datum( unsigned char datum )
+/// Append a pointer to the entry being recorded
+static void record_pointer( const void *pointer )
 {
-  volatile unsigned char dummy;
-
-  LCD_CS_0;
-
-  while( !(SSP0SR & SSP0SR_TNF) );
-  SSP0DR = datum | 0x100;
-  while( SSP0SR & SSP0SR_BSY );
-  dummy = SSP0DR;
+    list_put( &pointer, sizeof pointer );
+}
 
-  LCD_CS_1;
+/// Append a string to the entry being recorded
+static void record_string( const char *str )
+{
+    list_put( str, strlen( str ) + 1 );
 }
 
-void LCD_maximum_backlight( void )
+/** Hardware scroll state, in lines (page addresses)
+ * The displayed row top + i of the area shows the RAM line
+ * top + (i + offset) mod (bottom - top + 1)
+ */
+static struct
 {
-    LCD_adjust_backlight( 255 );
+    int top;    ///< First line of the scroll area
+    int bottom; ///< Last line of the scroll area
+    int offset; ///< Lines scrolled, a multiple of 4
+} scroll = { 0, 131, 0 };
+
+/** 8-bit color mode state
+ * The 256 colors are every combination of 8 red, 8 green and 4 blue
+ * levels, the color index being RRRGGGBB
+ */
+static struct
+{
+    int enabled;                  ///< Pixels sent as 8-bit color indexes
+    unsigned char red[8];         ///< 4-bit red levels
+    unsigned char green[8];       ///< 4-bit green levels
+    unsigned char blue[4];        ///< 4-bit blue levels
+    unsigned char red_index[16];  ///< Nearest red level to each intensity
+    unsigned char green_index[16]; ///< Nearest green level to each intensity
+    unsigned char blue_index[16]; ///< Nearest blue level to each intensity
+} palette = {
+    0,
+    { 0, 2, 4, 6, 9, 11, 13, 15 },
+    { 0, 2, 4, 6, 9, 11, 13, 15 },
+    { 0, 5, 10, 15 },
+    { 0 },
+    { 0 },
+    { 0 }
+    };
+
+/// 8-bit color index closest to a 12-bit color
+static unsigned char color_index( int color )
+{
+    return (palette.red_index[(color >> 8) & 0xF] << 5) |
+           (palette.green_index[(color >> 4) & 0xF] << 2) |
+           palette.blue_index[color & 0xF];
 }
 
-void LCD_turn_off_backlight( void )
+/// 12-bit color shown for an 8-bit color index
+static int index_color( unsigned char index )
 {
-    LCD_adjust_backlight( 0 );
+    return (palette.red[index >> 5] << 8) |
+           (palette.green[(index >> 2) & 7] << 4) |
+           palette.blue[index & 3];
 }
 
-void initialize_LCD( void )
+/// Index of the level nearest to each 4-bit intensity
+static void nearest_levels( unsigned char *index, const unsigned char *levels, int count )
 {
+    int v, i, d, best, best_d;
 
-    initialize_SSP0();
+    for( v = 0; v < 16; v++ )
+    {
+        best = 0;
+        best_d = 16;
+        for( i = 0; i < count; i++ )
+        {
+            d = (levels[i] > v) ? levels[i] - v : v - levels[i];
+            if( d < best_d )
+            {
+                best = i;
+                best_d = d;
+            }
+        }
+        index[v] = best;
+    }
+}
 
-    /* Configure the P1.21 pin as output to handle the Chip Select
-     * input pin of the LCD, which is low-level active
-     */
-    FIO1DIR |= 1<<21;
+/** GPDMA channel 0 state
+ * Transfers longer than DMA_MAXIMUM_TRANSFER frames are split in
+ * chunks, each one programmed by ISR_GPDMA() when the previous ends
+ */
+static struct
+{
+    unsigned short *buffer;          ///< Pattern buffer, NULL if the DMA is disabled
+    unsigned int size;               ///< Frames that fit in the pattern buffer
+    int pattern_color;               ///< Color stored in the pattern buffer, -1 if none
+    const unsigned short *source;    ///< Source of the next chunk
+    unsigned long control;           ///< Channel control word, without the transfer size
+    unsigned int chunk;              ///< Frames per chunk
+    int advance;                     ///< Move the source forward after each chunk
+    volatile unsigned int remaining; ///< Frames not programmed yet
+    volatile int active;             ///< Transfer in progress
+    volatile int release;            ///< Deassert the #CS when the transfer ends
+    void (*callback)( void );        ///< Function called when a transfer ends
+} dma;
+
+/** Transmit queue
+ * Ring buffer of 9-bit frames emptied into the SSP0 FIFO by ISR_SSP0()
+ */
+static struct
+{
+    unsigned short *buffer;       ///< Frames, NULL if the queue is disabled
+    unsigned int size;            ///< Size of the buffer
+    volatile unsigned int head;   ///< Next frame to send
+    volatile unsigned int tail;   ///< Next free position
+    unsigned int high_water_mark; ///< Maximum number of queued frames
+    unsigned long stalls;         ///< Times the queue was found full
+} queue;
+
+/// Number of frames in the transmit queue
+static unsigned int queue_used( void )
+{
+    unsigned int head = queue.head;
 
-    /* Configure the P3.25 pin as output to handle the Reset input of
-     * the LCD, which is low-level active
-     */
-    FIO3DIR |= 1<<25;
+    return (queue.tail >= head) ? queue.tail - head : queue.size - head + queue.tail;
+}
 
-    LCD_initialize_pwm_backlight();
+/// Queue a frame to be sent by ISR_SSP0(), waiting if the queue is full
+static void queue_frame( unsigned int frame )
+{
+    unsigned int next, used;
 
-    LCD_maximum_backlight();
+    next = queue.tail + 1;
+    if( next == queue.size ) next = 0;
 
-    // Make LCD hardware reset
-    LCD_CS_0;
-    LCD_RESET_0;
-    delay( 10000 );
-    LCD_RESET_1;
-    delay( 10000 );
-    LCD_CS_1;
+    if( next == queue.head )
+    {
+        queue.stalls++;
+        while( next == queue.head );
+    }
 
-    LCD_command( DISCTL );
-    LCD_datum( 0x00 );
-    LCD_datum( 0x20 );
-    LCD_datum( 0x0C );
-    LCD_datum( 0x00 );
+    queue.buffer[queue.tail] = frame;
+    queue.tail = next;
 
-    LCD_command( OSCON );
-    delay( 10000);
+    used = queue_used();
+    if( used > queue.high_water_mark )
+        queue.high_water_mark = used;
 
-    LCD_command( SLPOUT );
+    // Interrupt when the TX FIFO is at least half empty
+    SSP0IMSC |= 1<<3;
+}
 
-    LCD_command( VOLCTR );
-    LCD_datum( 0x24 );
-    LCD_datum( 0x03 );
+/** Send a frame through the transmit queue if enabled, or else queue it
+ * in the SSP0 FIFO once the DMA is done with it
+ */
+static void push_frame( unsigned int frame )
+{
+    while( dma.active );
 
-    LCD_command( DISINV );
+    if( queue.buffer )
+    {
+        queue_frame( frame );
+        return;
+    }
 
-    LCD_command( COMSCN );
-    LCD_datum( 0x01 );
+    while( !(SSP0SR & SSP0SR_TNF) );
+    SSP0DR = frame;
+}
 
-    LCD_command( PWRCTR );
-    LCD_datum( 0x0F );
-    delay( 10000 );
+/// Wait for the end of the transmission and deassert the #CS
+static void release_bus( void )
+{
+    // Wait for the last frame to leave the shift register
+    while( SSP0SR & SSP0SR_BSY );
 
-    LCD_command( DATCTL );
-    LCD_datum( 0x01 );
-    LCD_datum( 0x00 );
-    LCD_datum( 0x02 );
+    // Empty the receiving buffer, which overflows during long bursts
+    while( SSP0SR & SSP0SR_RNE ) (void)SSP0DR;
+    SSP0ICR = 1; // Clear the receive overrun flag
 
-    LCD_command(DISON);
+    LCD_CS_1;
 }
 
-void LCD_print_character( char c, int x, int y, int size, int color, int background_color )
+/// Program the next chunk of the current DMA transfer
+static void dma_next_chunk( void )
 {
-    extern const unsigned char FONT6x8[97][8];
-    extern const unsigned char FONT8x8[97][8];
-    extern const unsigned char FONT8x16[97][16];
+    unsigned int frames;
 
-    int i,j;
-    unsigned int nCols;
-    unsigned int nRows;
-    unsigned int nBytes;
-    unsigned char PixelRow;
-    unsigned char Mask;
-    unsigned int Word0;
-    unsigned int Word1;
-    unsigned char *pFont;
-    unsigned char *pChar;
-    unsigned char *FontTable[] = {
-        (unsigned char *)FONT6x8,
-        (unsigned char *)FONT8x8,
-        (unsigned char *)FONT8x16
-        };
+    frames = (dma.remaining > dma.chunk) ? dma.chunk : dma.remaining;
+    dma.remaining -= frames;
 
+    DMACC0SrcAddr = (unsigned long)dma.source;
+    DMACC0DestAddr = (unsigned long)&SSP0DR;
+    DMACC0LLI = 0;
+    DMACC0Control = dma.control | frames;
 
-    pFont = (unsigned char *)FontTable[size];
+    /* Enable the channel for a memory to peripheral transfer to the
+     * SSP0 TX, with the error and terminal count interruptions
+     */
+    DMACC0Configuration = 1 | (0<<6) | (1<<11) | (1<<14) | (1<<15);
 
-    nCols = *pFont;
-    nRows = *(pFont + 1);
-    nBytes = *(pFont + 2);
+    if( dma.advance )
+        dma.source += frames;
+}
 
-    pChar = pFont + (nBytes * (c - 0x1F)) + nBytes - 1;
+/** Start a DMA transfer of 9-bit frames to the SSP0
+ * \param source Frames, in memory reachable by the GPDMA
+ * \param frames Number of frames to send
+ * \param chunk Maximum frames per chunk
+ * \param advance Each chunk continues where the previous one ended
+ * (otherwise each chunk starts again from source)
+ * \param increment Increment the source address after every frame
+ * (otherwise the same frame is sent again and again)
+ */
+static void dma_start( const unsigned short *source, unsigned int frames,
+                       unsigned int chunk, int advance, int increment )
+{
+    // The frames already in the transmit queue go first
+    LCD_wait_idle();
 
-    LCD_command( PASET );
-    LCD_datum( x );
-    LCD_datum( x + nRows - 1 );
+    dma.source = source;
+    dma.remaining = frames;
+    dma.chunk = chunk;
+    dma.advance = advance;
 
-    LCD_command(CASET);
-    LCD_datum( y );
-    LCD_datum( y + nCols - 1 );
+    // Bursts of 4 halfwords, the TX FIFO half, and terminal count interruption
+    dma.control = (1<<12) | (1<<15) | (1<<18) | (1<<21) | (1UL<<31);
+    if( increment )
+        dma.control |= 1<<26;
 
-    LCD_command( RAMWR );
+    dma.active = 1;
+    dma_next_chunk();
+}
 
-    for (i = nRows - 1; i >= 0; i--)
-    {
+/** Send pixels of the same color through the DMA
+ * \param color 12-bit color
+ * \param pixels Number of pixels, even in 12-bit color mode
+ */
+static void dma_fill( int color, unsigned int pixels )
+{
+    unsigned short b0, b1, b2;
+    unsigned int i, length;
 
-        PixelRow = *pChar--;
+    while( dma.active );
 
-        Mask = 0x80;
-        for (j = 0; j < nCols; j += 2)
-        {
-            if ((PixelRow & Mask) == 0)
-                Word0 = background_color;
-            else
-                Word0 = color;
+    // In 8-bit color mode every pixel is the same frame
+    if( palette.enabled )
+    {
+        dma.buffer[0] = color_index( color ) | 0x100;
+        dma.pattern_color = -1;
+        dma_start( dma.buffer, pixels, DMA_MAXIMUM_TRANSFER, 0, 0 );
+        return;
+    }
 
-            Mask = Mask >> 1;
+    b0 = ((color >> 4) & 0xFF) | 0x100;
+    b1 = (((color & 0xF) << 4) | ((color >> 8) & 0xF)) | 0x100;
+    b2 = (color & 0xFF) | 0x100;
 
-            if ((PixelRow & Mask) == 0)
-                Word1 = background_color;
-            else
-                Word1 = color;
+    // Grays are the same frame repeated, so the source address is fixed
+    if( b0 == b1 && b1 == b2 )
+    {
+        dma.buffer[0] = b0;
+        dma.pattern_color = -1;
+        dma_start( dma.buffer, (pixels / 2) * 3, DMA_MAXIMUM_TRANSFER, 0, 0 );
+        return;
+    }
 
-            Mask = Mask >> 1;
+    // Other colors repeat the pattern buffer filled with pixel pairs
+    length = (dma.size < DMA_MAXIMUM_TRANSFER) ? dma.size : DMA_MAXIMUM_TRANSFER;
+    length -= length % 3;
 
-            LCD_datum( (Word0 >> 4) & 0xFF );
-            LCD_datum( ( (Word0 & 0xF) << 4) | ( (Word1 >> 8) & 0xF ) );
-            LCD_datum( Word1 & 0xFF );
+    if( dma.pattern_color != color )
+    {
+        for( i = 0; i < length; i += 3 )
+        {
+            dma.buffer[i] = b0;
+            dma.buffer[i + 1] = b1;
+            dma.buffer[i + 2] = b2;
         }
+        dma.pattern_color = color;
     }
+
+    dma_start( dma.buffer, (pixels / 2) * 3, length, 0, 1 );
 }
 
-void LCD_print_string( char *str, int x, int y, int size, int color, int background_color )
+/** Drawing window
+ * Every primitive opens a window with window_begin(), writes the
+ * pixels in the scan order of the controller (column address first,
+ * then page address) and closes it with window_end()
+ */
+static struct
 {
-
-    while( *str)
-    {
-
-        LCD_print_character( *str++, x, y, size, color, background_color );
-
-        if( size == SMALL_FONT )
-          y = y + 6;
-        else if( size == MEDIUM_FONT )
-          y = y + 8;
-        else
-          y = y + 8;
-
-        if( y > 131 ) break;
-    }
+    int x0, y0, x1, y1;     ///< Window limits, inside the clip rectangle
+    int x, y;               ///< Framebuffer write position
+    int first_color;        ///< First pixel written, -1 if none
+    int pending_color;      ///< Pixel waiting for its pair, -1 if none
+    int visible;            ///< Some part of the window is inside the clip rectangle
+    int clipped;            ///< Some part of the window is outside the clip rectangle
+    int wx0, wy0, wx1, wy1; ///< Window limits asked for by the primitive
+    int wx, wy;             ///< Position in the window asked for
+} window;
+
+/// Check if a rectangle touches the clip rectangle
+static int clip_visible( int x0, int y0, int x1, int y1 )
+{
+    return x0 <= clip.x1 && x1 >= clip.x0 && y0 <= clip.y1 && y1 >= clip.y0;
 }
 
-void delay( volatile unsigned int t )
+/// Send two 12-bit pixels packed in three bytes
+static void send_pixel_pair( int color0, int color1 )
 {
-  while(t--);
+    LCD_burst_datum( (color0 >> 4) & 0xFF );
+    LCD_burst_datum( ((color0 & 0xF) << 4) | ((color1 >> 8) & 0xF) );
+    LCD_burst_datum( color1 & 0xFF );
 }
 
-void LCD_clear( void )
+/** Start the transfers of a primitive
+ * Keeps the #CS asserted across all its windows when drawing on the
+ * screen
+ */
+static void transfer_begin( void )
 {
-    unsigned long i;
+    if( !framebuffer )
+        LCD_burst_begin();
+}
 
-    LCD_command(PASET);
-    LCD_datum(0);
-    LCD_datum(131);
+/// End the transfers of a primitive
+static void transfer_end( void )
+{
+    if( !framebuffer )
+        LCD_burst_end();
+}
 
+/// Read a pixel of the framebuffer
+static int framebuffer_color( int x, int y )
+{
+    unsigned char *p = framebuffer + (x - framebuffer_x0) * FRAMEBUFFER_ROW + (y >> 1) * 3;
 
-    LCD_command(CASET);
-    LCD_datum(0);
-    LCD_datum(131);
+    if( y & 1 )
+        return ((p[1] & 0xF) << 8) | p[2];
 
-    LCD_command(RAMWR);
-    for(i = 0; i < ((131 * 131) / 2); i++)
-    {
-        LCD_datum( (WHITE >> 4) & 0xFF);
-        LCD_datum( ( (WHITE & 0xF) << 4 ) | ( (WHITE >> 8) & 0xF ) );
-        LCD_datum( WHITE & 0xFF );
-    }
+    return (p[0] << 4) | (p[1] >> 4);
 }
 
-void LCD_pixel( int x, int y, int color )
+/// Store a pixel in the framebuffer, ignoring it if off-screen
+static void framebuffer_pixel( int x, int y, int color )
 {
+    unsigned char *p;
 
-    LCD_command( PASET );
-    LCD_datum(x);
-    LCD_datum(x);
+    if( x < framebuffer_x0 || x > framebuffer_x1 || y < 0 || y > 131 ) return;
 
-    LCD_command( CASET );
-    LCD_datum(y);
-    LCD_datum(y);
+    p = framebuffer + (x - framebuffer_x0) * FRAMEBUFFER_ROW + (y >> 1) * 3;
 
-    LCD_command(RAMWR);
-    LCD_datum( (color >> 4) & 0xFF);
-    LCD_datum(((color & 0xF) << 4) | ((color >> 8) & 0xF));
-    LCD_datum(color & 0xFF);
+    if( y & 1 )
+    {
+        p[1] = (p[1] & 0xF0) | ((color >> 8) & 0xF);
+        p[2] = color & 0xFF;
+    }
+    else
+    {
+        p[0] = (color >> 4) & 0xFF;
+        p[1] = ((color & 0xF) << 4) | (p[1] & 0x0F);
+    }
 }
 
-void LCD_line( int x1, int y1, int x2, int y2, int color )
+/** Add a rectangle to the dirty list
+ * It is merged with a touching rectangle if there is one. When the list
+ * is full it is merged with the rectangle whose area grows the least.
+ */
+static void mark_dirty( int x0, int y0, int x1, int y1 )
 {
-    int   d, dx, dy;
-    int   Aincr, Bincr, xincr, yincr;
-    int   x, y;
-    int   temp;
+    struct rectangle *r;
+    int i, growth, best, best_growth;
 
-    dx = x2 - x1;
-    if( dx < 0 ) dx = -dx;
+    if( x0 < 0 ) x0 = 0;
+    if( y0 < 0 ) y0 = 0;
+    if( x1 > 131 ) x1 = 131;
+    if( y1 > 131 ) y1 = 131;
+    if( x0 > x1 || y0 > y1 ) return;
 
-    dy = y2 - y1;
-    if( dy < 0 ) dy = -dy;
+    best = -1;
+    best_growth = 0;
 
-    if( dx >= dy )
+    for( i = 0; i < dirty_count; i++ )
     {
-        if (x1 > x2)
-        {
-            temp = x1;
-            x1 = x2;
-            x2 = temp;
+        r = &dirty[i];
 
-            temp = y1;
-            y1 = y2;
-            y2 = temp;
+        if( x0 <= r->x1 + 1 && x1 + 1 >= r->x0 && y0 <= r->y1 + 1 && y1 + 1 >= r->y0 )
+        {
+            best = i;
+            break;
         }
 
-        if (y2 > y1)
-            yincr = 1;
-        else
-            yincr = -1;
-
-        d = 2 * dy - dx;
-
-        Aincr = 2 * (dy - dx);
-        Bincr = 2 * dy;
+        growth = (((x1 > r->x1) ? x1 : r->x1) - ((x0 < r->x0) ? x0 : r->x0) + 1) *
+                 (((y1 > r->y1) ? y1 : r->y1) - ((y0 < r->y0) ? y0 : r->y0) + 1) -
+                 (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
 
-        x = x1;
-        y = y1;
-
-        LCD_pixel( x, y, color );
-
-        for (x = x1 + 1; x <= x2; x++ )
+        if( best < 0 || growth < best_growth )
         {
-            if (d >= 0)
-            {
-                y += yincr;
-                d += Aincr;
-            }
-            else
-                d += Bincr;
-
-            LCD_pixel( x, y, color );
+            best = i;
+            best_growth = growth;
         }
     }
-    else
+
+    if( best < 0 || (i == dirty_count && dirty_count < LCD_DIRTY_RECTANGLES) )
     {
-        if (y1 > y2)
-        {
-            temp = x1;
-            x1 = x2;
-            x2 = temp;
+        r = &dirty[dirty_count++];
+        r->x0 = x0;
+        r->y0 = y0;
+        r->x1 = x1;
+        r->y1 = y1;
+        return;
+    }
 
-            temp = y1;
-            y1 = y2;
-            y2 = temp;
-        }
+    r = &dirty[best];
+    if( x0 < r->x0 ) r->x0 = x0;
+    if( y0 < r->y0 ) r->y0 = y0;
+    if( x1 > r->x1 ) r->x1 = x1;
+    if( y1 > r->y1 ) r->y1 = y1;
+}
 
-        if (x2 > x1)
-            xincr = 1;
-        else
-            xincr = -1;
+/** Open a drawing window on the screen or the framebuffer
+ * Only the part of the window inside the clip rectangle is opened, and
+ * nothing is sent if there is none
+ */
+static void window_begin( int x0, int y0, int x1, int y1 )
+{
+    window.wx0 = x0;
+    window.wy0 = y0;
+    window.wx1 = x1;
+    window.wy1 = y1;
+    window.wx = x0;
+    window.wy = y0;
+
+    window.clipped = x0 < clip.x0 || y0 < clip.y0 || x1 > clip.x1 || y1 > clip.y1;
+    window.visible = clip_visible( x0, y0, x1, y1 );
+    if( !window.visible ) return;
+
+    if( window.clipped )
+    {
+        if( x0 < clip.x0 ) x0 = clip.x0;
+        if( y0 < clip.y0 ) y0 = clip.y0;
+        if( x1 > clip.x1 ) x1 = clip.x1;
+        if( y1 > clip.y1 ) y1 = clip.y1;
+    }
 
-        d = 2 * dx - dy;
+    window.x0 = x0;
+    window.y0 = y0;
+    window.x1 = x1;
+    window.y1 = y1;
+    window.x = x0;
+    window.y = y0;
+    window.first_color = -1;
+    window.pending_color = -1;
 
-        Aincr = 2 * (dx - dy);
-        Bincr = 2 * dx;
+    if( framebuffer )
+    {
+        mark_dirty( x0, y0, x1, y1 );
+        return;
+    }
 
-        x = x1;
-        y = y1;
+    LCD_burst_begin();
 
-        LCD_pixel( x, y, color );
+    LCD_burst_command( PASET );
+    LCD_burst_datum( x0 );
+    LCD_burst_datum( x1 );
 
-        for (y=y1+1; y<=y2; y++)
-        {
-            if (d >= 0)
-            {
-                x += xincr;
-                d += Aincr;
-            }
-            else
-                d += Bincr;
+    LCD_burst_command( CASET );
+    LCD_burst_datum( y0 );
+    LCD_burst_datum( y1 );
 
-            LCD_pixel( x, y, color );
-        }
-    }
+    LCD_burst_command( RAMWR );
 }
 
-void LCD_rectangle(int x0, int y0, int x1, int y1, unsigned char fill, int color )
+/// Write the next pixel of the opened window
+static void put_pixel( int color )
 {
-    int xmin, xmax, ymin, ymax;
-    int i;
-
-    if( fill )
+    if( framebuffer )
     {
+        framebuffer_pixel( window.x, window.y, color );
 
-        xmin = (x0 <= x1) ? x0 : x1;
-        xmax = (x0 > x1) ? x0 : x1;
-        ymin = (y0 <= y1) ? y0 : y1;
-        ymax = (y0 > y1) ? y0 : y1;
-
-        LCD_command( PASET );
-        LCD_datum( xmin );
-        LCD_datum( xmax );
-
-        LCD_command( CASET );
-        LCD_datum( ymin );
-        LCD_datum( ymax );
-
-        LCD_command( RAMWR );
-
-        for (i = 0; i < ((((xmax - xmin + 1) * (ymax - ymin + 1)) / 2) + 130); i++)
+        if( ++window.y > window.y1 )
         {
-            LCD_datum((color >> 4) & 0xFF);
-            LCD_datum(((color & 0xF) << 4) | ((color >> 8) & 0xF));
-            LCD_datum(color & 0xFF);
+            window.y = window.y0;
+            if( ++window.x > window.x1 )
+                window.x = window.x0;
         }
+        return;
+    }
+
+    // 8-bit pixels need no pairing
+    if( palette.enabled )
+    {
+        LCD_burst_datum( color_index( color ) );
+        return;
     }
+
+    if( window.first_color < 0 )
+        window.first_color = color;
+
+    if( window.pending_color < 0 )
+        window.pending_color = color;
     else
     {
-        LCD_line( x0, y0, x1, y0, color );
-        LCD_line( x0, y1, x1, y1, color );
-        LCD_line( x0, y0, x0, y1, color );
-        LCD_line( x1, y0, x1, y1, color );
+        send_pixel_pair( window.pending_color, color );
+        window.pending_color = -1;
     }
 }
 
-void LCD_circumference( int x0, int y0, int radius, int color )
+/// Write the next count pixels of the opened window with the same color
+static void put_pixels( int color, unsigned int count )
 {
-    int f = 1 - radius;
-    int ddF_x = 0;
-    int ddF_y = -2*radius;
-    int x = 0;
-    int y = radius;
-
-    LCD_pixel( x0, y0 + radius, color );
-    LCD_pixel( x0, y0 - radius, color );
-    LCD_pixel( x0 + radius, y0, color );
-    LCD_pixel( x0 - radius, y0, color );
+    unsigned int pairs;
+    unsigned char index;
 
-    while( x < y )
+    if( !framebuffer && palette.enabled )
     {
-        if( f >= 0 )
+        if( dma.buffer && count >= 2 * DMA_MINIMUM_PAIRS )
+            dma_fill( color, count );
+        else
         {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
+            index = color_index( color );
+            while( count-- )
+                LCD_burst_datum( index );
         }
+        return;
+    }
+
+    if( !framebuffer && count )
+    {
+        if( window.pending_color >= 0 )
+        {
+            put_pixel( color );
+            count--;
+        }
+        else if( window.first_color < 0 )
+        {
+            // The padding of a window filled with one color is that color
+            if( count == (unsigned int)((window.x1 - window.x0 + 1) * (window.y1 - window.y0 + 1)) )
+                count += count & 1;
+
+            window.first_color = color;
+        }
+
+        pairs = count / 2;
+        count &= 1;
+
+        if( dma.buffer && dma.size >= 3 && pairs >= DMA_MINIMUM_PAIRS )
+            dma_fill( color, pairs * 2 );
+        else
+            while( pairs-- )
+                send_pixel_pair( color, color );
+    }
+
+    while( count-- )
+        put_pixel( color );
+}
+
+/// Move the position in the window asked for to the next row
+static void window_next_row( void )
+{
+    window.wy = window.wy0;
+    if( ++window.wx > window.wx1 )
+        window.wx = window.wx0;
+}
+
+/// Write the next pixel of the window
+static void write_pixel( int color )
+{
+    if( !window.clipped )
+    {
+        put_pixel( color );
+        return;
+    }
+
+    // Only the pixels inside the opened window are sent
+    if( window.visible && window.wx >= window.x0 && window.wx <= window.x1 &&
+        window.wy >= window.y0 && window.wy <= window.y1 )
+        put_pixel( color );
+
+    if( ++window.wy > window.wy1 )
+        window_next_row();
+}
+
+/// Write the next count pixels of the window with the same color
+static void write_pixels( int color, unsigned int count )
+{
+    int n, first, last;
+
+    if( !window.clipped )
+    {
+        put_pixels( color, count );
+        return;
+    }
+
+    // Row by row, sending the part inside the opened window
+    while( count )
+    {
+        n = window.wy1 - window.wy + 1;
+        if( (unsigned int)n > count ) n = count;
+
+        if( window.visible && window.wx >= window.x0 && window.wx <= window.x1 )
+        {
+            first = (window.wy > window.y0) ? window.wy : window.y0;
+            last = window.wy + n - 1;
+            if( last > window.y1 ) last = window.y1;
+
+            if( first <= last )
+                put_pixels( color, last - first + 1 );
+        }
+
+        count -= n;
+        window.wy += n;
+        if( window.wy > window.wy1 )
+            window_next_row();
+    }
+}
+
+/** Close the drawing window
+ * The controller takes the pixels in pairs, so an odd pixel is padded
+ * with the first one of the window, which is where the padding lands
+ * once the window is complete.
+ */
+static void window_end( void )
+{
+    if( !window.visible ) return;
+
+    if( window.pending_color >= 0 )
+    {
+        send_pixel_pair( window.pending_color, window.first_color );
+        window.pending_color = -1;
+    }
+
+    transfer_end();
+}
+
+/// Bytes sent to the controller for a number of pixels, which must be even
+static unsigned int pixel_bytes( unsigned int pixels )
+{
+    return palette.enabled ? pixels : (pixels / 2) * 3;
+}
+
+/** Write the next pixels of the window, already packed in pairs
+ * \param data Pixels as sent to the controller: three bytes every two
+ * pixels, or one byte per pixel in 8-bit color mode
+ * \param pairs Number of pixel pairs
+ */
+static void write_packed( const unsigned char *data, unsigned int pairs )
+{
+    if( palette.enabled )
+    {
+        if( !framebuffer && !window.clipped )
+            LCD_burst_data( data, pairs * 2 );
+        else
+            for( pairs *= 2; pairs; pairs-- )
+                write_pixel( index_color( *data++ ) );
+        return;
+    }
+
+    if( !framebuffer && !window.clipped && window.pending_color < 0 )
+    {
+        if( window.first_color < 0 )
+            window.first_color = (data[0] << 4) | (data[1] >> 4);
+
+        LCD_burst_data( data, pairs * 3 );
+        return;
+    }
+
+    while( pairs-- )
+    {
+        write_pixel( (data[0] << 4) | (data[1] >> 4) );
+        write_pixel( ((data[1] & 0xF) << 8) | data[2] );
+        data += 3;
+    }
+}
+
+/** Fill a rectangle with one window
+ * The limits must be ordered: x0 <= x1 and y0 <= y1
+ */
+static void fill_rectangle( int x0, int y0, int x1, int y1, int color )
+{
+    // A solid fill is clipped by just shrinking its window
+    if( x0 < clip.x0 ) x0 = clip.x0;
+    if( y0 < clip.y0 ) y0 = clip.y0;
+    if( x1 > clip.x1 ) x1 = clip.x1;
+    if( y1 > clip.y1 ) y1 = clip.y1;
+    if( x0 > x1 || y0 > y1 ) return;
+
+    window_begin( x0, y0, x1, y1 );
+    write_pixels( color, (x1 - x0 + 1) * (y1 - y0 + 1) );
+    window_end();
+}
+
+/** Midpoint stepping along a quadrant of an ellipse, from the end of
+ * its Y radius to the end of its X radius
+ * The decision values are scaled by 4 to keep them integer, and only
+ * change by additions, as in LCD_circumference(). They are 64-bit so
+ * that radii beyond the screen do not overflow.
+ */
+struct ellipse_steps
+{
+    long long a2, b2;  ///< Squared radii along X and Y
+    long long px, py;  ///< 2 b2 x and 2 a2 y
+    long long d;       ///< Decision value of the next step
+    int x, y;          ///< Current point
+    int region;        ///< 1 while the slope is under 1, then 2
+};
+
+/// Start stepping along an ellipse of radii rx and ry
+static void ellipse_begin( struct ellipse_steps *e, int rx, int ry )
+{
+    e->a2 = (long long)rx * rx;
+    e->b2 = (long long)ry * ry;
+    e->x = 0;
+    e->y = ry;
+    e->px = 0;
+    e->py = 2 * e->a2 * ry;
+    e->d = 4 * e->b2 - 4 * e->a2 * ry + e->a2;
+    e->region = 1;
+}
+
+/// Move to the next point of the quadrant
+static void ellipse_step( struct ellipse_steps *e )
+{
+    if( e->region == 1 && e->px >= e->py )
+    {
+        // Midpoint (x + 1/2, y - 1) from now on
+        e->region = 2;
+        e->d = e->b2 * (2 * e->x + 1) * (2 * e->x + 1) +
+               4 * e->a2 * (e->y - 1) * (e->y - 1) - 4 * e->a2 * e->b2;
+    }
+
+    if( e->region == 1 )
+    {
+        e->x++;
+        e->px += 2 * e->b2;
+        if( e->d < 0 )
+            e->d += 4 * (e->px + e->b2);
+        else
+        {
+            e->y--;
+            e->py -= 2 * e->a2;
+            e->d += 4 * (e->px - e->py + e->b2);
+        }
+    }
+    else
+    {
+        e->y--;
+        e->py -= 2 * e->a2;
+        if( e->d > 0 )
+            e->d += 4 * (e->a2 - e->py);
+        else
+        {
+            e->x++;
+            e->px += 2 * e->b2;
+            e->d += 4 * (e->px - e->py + e->a2);
+        }
+    }
+}
+
+/** Half width of the next row of the quadrant: the biggest Y of the
+ * points at the current X, which then moves one row outwards
+ */
+static int ellipse_row( struct ellipse_steps *e )
+{
+    int x = e->x, w = e->y;
+
+    if( w < 0 ) return 0;
+
+    while( e->x == x && e->y >= 0 )
+        ellipse_step( e );
+
+    return w;
+}
+
+/** Draw the quadrants of an ellipse pulled apart so that their centers
+ * are the corners of a rectangle, as horizontal spans
+ * With a single center it draws an ellipse, and with equal radii a
+ * rounded rectangle.
+ * \param xa Smallest X coordinate of the centers
+ * \param ya Smallest Y coordinate of the centers
+ * \param xb Biggest X coordinate of the centers
+ * \param yb Biggest Y coordinate of the centers
+ * \param rx Radius along the X axis
+ * \param ry Radius along the Y axis
+ * \param fill Fill in the shape: FILL, NO_FILL
+ * \param color Perimeter and fill color
+ */
+static void draw_quadrants( int xa, int ya, int xb, int yb, int rx, int ry,
+                            unsigned char fill, int color )
+{
+    struct ellipse_steps e;
+    int dx, w, next, inner;
+
+    if( !clip_visible( xa - rx, ya - ry, xb + rx, yb + ry ) ) return;
+
+    transfer_begin();
+
+    ellipse_begin( &e, rx, ry );
+    next = ellipse_row( &e );
+
+    for( dx = 0; dx <= rx; dx++ )
+    {
+        w = next;
+        next = (dx < rx) ? ellipse_row( &e ) : 0;
+
+        if( fill )
+        {
+            fill_rectangle( xa - dx, ya - w, xa - dx, yb + w, color );
+            if( dx || xb != xa )
+                fill_rectangle( xb + dx, ya - w, xb + dx, yb + w, color );
+            continue;
+        }
+
+        // Columns not covered by the outline of the next row outwards
+        inner = (dx < rx) ? next + 1 : 0;
+        if( inner > w ) inner = w;
+
+        if( inner == 0 )
+        {
+            fill_rectangle( xa - dx, ya - w, xa - dx, yb + w, color );
+            if( dx || xb != xa )
+                fill_rectangle( xb + dx, ya - w, xb + dx, yb + w, color );
+        }
+        else
+        {
+            fill_rectangle( xa - dx, ya - w, xa - dx, ya - inner, color );
+            fill_rectangle( xa - dx, yb + inner, xa - dx, yb + w, color );
+            if( dx || xb != xa )
+            {
+                fill_rectangle( xb + dx, ya - w, xb + dx, ya - inner, color );
+                fill_rectangle( xb + dx, yb + inner, xb + dx, yb + w, color );
+            }
+        }
+    }
+
+    // Rows between the centers
+    if( xb - xa > 1 )
+    {
+        if( fill )
+            fill_rectangle( xa + 1, ya - ry, xb - 1, yb + ry, color );
+        else
+        {
+            fill_rectangle( xa + 1, ya - ry, xb - 1, ya - ry, color );
+            fill_rectangle( xa + 1, yb + ry, xb - 1, yb + ry, color );
+        }
+    }
+
+    transfer_end();
+}
+
+/// Index of a character in the font tables, that of '?' if it is not there
+static int glyph_index( char c )
+{
+    unsigned char u = c;
+
+    return (u >= 0x20 && u <= 0x7F) ? u - 0x1F : '?' - 0x1F;
+}
+
+/** Fonts described at compile time
+ * The dimensions are the ones in the header row of each table, so the
+ * rendering loops instantiated for a font have constant bounds and can
+ * be unrolled. row() gives a row of a character with its leftmost pixel
+ * in the most significant bit, the rows numbered from the top one.
+ */
+struct font_6x8
+{
+    enum { columns = 6, rows = 8, bytes = 6 };
+
+    /// Unpack a row: 4 rows of 6 bits every 3 bytes
+    static unsigned char row( char c, int i )
+    {
+        const unsigned char *p = FONT6x8[glyph_index( c )] + (i >> 2) * 3;
+        unsigned long bits = ((unsigned long)p[0] << 16) | (p[1] << 8) | p[2];
+
+        return ((bits >> (18 - 6 * (i & 3))) & 0x3F) << 2;
+    }
+};
+
+struct font_8x8
+{
+    enum { columns = 8, rows = 8, bytes = 8 };
+
+    static unsigned char row( char c, int i ) { return FONT8x8[glyph_index( c )][i]; }
+};
+
+struct font_8x16
+{
+    enum { columns = 8, rows = 16, bytes = 16 };
+
+    static unsigned char row( char c, int i ) { return FONT8x16[glyph_index( c )][i]; }
+};
+
+/** Pack a glyph in the order it is sent to the controller: the rows
+ * from the bottom up, two pixels every three bytes, or one byte per
+ * pixel in 8-bit color mode
+ * \param color Character color, a color index in 8-bit color mode
+ * \param background_color Background color, a color index in 8-bit
+ * color mode
+ * \return Number of bytes written
+ */
+template <class Font, bool EIGHT_BIT>
+static unsigned int pack_font_glyph( unsigned char *data, char c, int color, int background_color )
+{
+    int i, j;
+    unsigned char PixelRow;
+    unsigned int Word0;
+    unsigned int Word1;
+    unsigned char *start = data;
+
+    for (i = 0; i < Font::rows; i++)
+    {
+        PixelRow = Font::row( c, Font::rows - 1 - i );
+
+        for (j = 0; j < Font::columns; j += 2)
+        {
+            Word0 = (PixelRow & (0x80 >> j)) ? color : background_color;
+            Word1 = (PixelRow & (0x40 >> j)) ? color : background_color;
+
+            if (EIGHT_BIT)
+            {
+                *data++ = Word0;
+                *data++ = Word1;
+                continue;
+            }
+
+            *data++ = (Word0 >> 4) & 0xFF;
+            *data++ = ((Word0 & 0xF) << 4) | ((Word1 >> 8) & 0xF);
+            *data++ = Word1 & 0xFF;
+        }
+    }
+
+    return data - start;
+}
+
+/// Pack a glyph of a font in the current color mode
+template <class Font>
+static unsigned int pack_font_glyph( unsigned char *data, char c, int color, int background_color )
+{
+    if( palette.enabled )
+        return pack_font_glyph<Font, true>( data, c, color_index( color ),
+                                            color_index( background_color ) );
+
+    return pack_font_glyph<Font, false>( data, c, color, background_color );
+}
+
+/** Pack a glyph of any font size
+ * \return Number of bytes written
+ */
+static unsigned int pack_glyph( unsigned char *data, char c, int size, int color, int background_color )
+{
+    switch( size )
+    {
+    case SMALL_FONT:
+        return pack_font_glyph<font_6x8>( data, c, color, background_color );
+    case MEDIUM_FONT:
+        return pack_font_glyph<font_8x8>( data, c, color, background_color );
+    case BIG_FONT:
+        return pack_font_glyph<font_8x16>( data, c, color, background_color );
+    }
+
+    return 0;
+}
+
+#if LCD_GLYPH_CACHE_ENTRIES > 0
+/// Glyph packed with a pair of colors
+struct glyph_cache_entry
+{
+    unsigned long last_use;         ///< Cache clock when last used, 0 if free
+    char c;                         ///< Character
+    unsigned char size;             ///< Font size
+    int color;                      ///< Character color
+    int background_color;           ///< Background color
+    unsigned char data[GLYPH_BYTES]; ///< Glyph packed by pack_glyph()
+};
+
+/// Recently printed glyphs
+static struct glyph_cache_entry glyph_cache[LCD_GLYPH_CACHE_ENTRIES];
+
+/// Counter of glyph cache accesses, used to find the least recently used entry
+static unsigned long glyph_cache_clock;
+
+/// Entries used after this clock value cannot be replaced
+static unsigned long glyph_cache_pin;
+#endif
+
+/// Glyph cache statistics
+static unsigned long glyph_cache_hits, glyph_cache_misses;
+
+/// Drop the cached glyphs, whose colors are no longer valid
+static void glyph_cache_invalidate( void )
+{
+#if LCD_GLYPH_CACHE_ENTRIES > 0
+    int i;
+
+    for( i = 0; i < LCD_GLYPH_CACHE_ENTRIES; i++ )
+        glyph_cache[i].last_use = 0;
+    glyph_cache_clock = 0;
+#endif
+}
+
+#if LCD_GLYPH_CACHE_ENTRIES > 0
+/** Get a packed glyph from the cache
+ * A missing glyph is packed in the least recently used entry, as long
+ * as it has not been used after glyph_cache_pin.
+ * \return Packed glyph, or NULL if every entry is pinned
+ */
+static const unsigned char *cached_glyph( char c, int size, int color, int background_color )
+{
+    struct glyph_cache_entry *entry;
+    struct glyph_cache_entry *victim = 0;
+
+    for( entry = glyph_cache; entry < glyph_cache + LCD_GLYPH_CACHE_ENTRIES; entry++ )
+    {
+        if( entry->last_use && entry->c == c && entry->size == size &&
+            entry->color == color && entry->background_color == background_color )
+        {
+            glyph_cache_hits++;
+            entry->last_use = ++glyph_cache_clock;
+            return entry->data;
+        }
+
+        if( entry->last_use <= glyph_cache_pin &&
+            (!victim || entry->last_use < victim->last_use) )
+            victim = entry;
+    }
+
+    glyph_cache_misses++;
+
+    if( !victim ) return 0;
+
+    pack_glyph( victim->data, c, size, color, background_color );
+    victim->c = c;
+    victim->size = size;
+    victim->color = color;
+    victim->background_color = background_color;
+    victim->last_use = ++glyph_cache_clock;
+
+    return victim->data;
+}
+#endif
+
+void initialize_SSP0( void )
+{
+  unsigned int i;
+
+  // Assign pins to SCK0, MOSI0 and MISO0
+  PINSEL3 |= (3<<16) | (3<<14) | (3<<8);
+
+  // The P1.21 pin controls the #CS signal of the LCD.
+  // Set the pin as output
+  FIO1DIR |= 1<<21;
+
+  // Deactivate the #CS
+  LCD_CS_1;
+
+  // Set up power for the SSP0 module
+  PCONP |= 1<<21;
+
+  // Configuration
+
+  SSP0CR1 = 0;
+  SSP0IMSC = 0;
+  SSP0DMACR = 0;
+  SSP0CPSR = 8; // SSP0 clock divider
+  SSP0CR0 = (9-1);
+  SSP0CR1 |= SSP0CR1_SSE; // Enable SSP0
+
+  // Empty the receiving buffer
+  for (i = 0; i < 8; i++ )  (void)SSP0DR;
+}
+
+void LCD_initialize_pwm_backlight( void )
+{
+  PINSEL3 = (PINSEL3 & ~(3<<20)) | 2<<20;
+  PCONP |= 1<<6;
+  PWM1TCR = PWM1TCR_Counter_Reset;
+
+  PWM1MCR = PWM1MCR_PWMMR0R;
+  PWM1PCR = PWM1PCR_PWMENA6;
+
+  PWM1PR = 0;
+  PWM1MR0 = 0xFF;
+  PWM1LER |= PWM1LER_Enable_PWM_Match_0_Latch;
+  PWM1MR6 = 0;
+  PWM1LER |= PWM1LER_Enable_PWM_Match_6_Latch;
+  PWM1TCR |= PWM1TCR_PWM_Enable;
+  PWM1TCR &= ~PWM1TCR_Counter_Reset;
+  PWM1TCR |= PWM1TCR_Counter_Enable;
+
+  LCD_adjust_backlight( 0 ); /// Initially off
+}
+
+void LCD_adjust_backlight( unsigned char intensity )
+{
+  PWM1MR6 = intensity;
+  PWM1LER |= PWM1LER_Enable_PWM_Match_6_Latch;
+}
+
+void LCD_command( unsigned char command )
+{
+  LCD_burst_begin();
+  LCD_burst_command( command );
+  LCD_burst_end();
+}
+
+void LCD_datum( unsigned char datum )
+{
+  LCD_burst_begin();
+  LCD_burst_datum( datum );
+  LCD_burst_end();
+}
+
+void LCD_burst_begin( void )
+{
+  // The transmit queue keeps the #CS asserted while enabled
+  if( burst_depth++ == 0 && !queue.buffer )
+  {
+    // A DMA transfer may still be holding the bus
+    LCD_dma_wait();
+    LCD_CS_0;
+  }
+}
+
+void LCD_burst_command( unsigned char command )
+{
+  push_frame( command );
+}
+
+void LCD_burst_datum( unsigned char datum )
+{
+  push_frame( datum | 0x100 );
+}
+
+void LCD_burst_data( const unsigned char *data, unsigned int count )
+{
+  while( count-- )
+    push_frame( *data++ | 0x100 );
+}
+
+void LCD_burst_end( void )
+{
+  if( --burst_depth > 0 || queue.buffer ) return;
+
+  // A running DMA transfer releases the bus when it ends
+  if( dma.active )
+  {
+    VICIntEnClr = 1<<25;
+    if( dma.active )
+    {
+      dma.release = 1;
+      VICIntEnable = 1<<25;
+      return;
+    }
+    VICIntEnable = 1<<25;
+  }
+
+  release_bus();
+}
+
+void LCD_maximum_backlight( void )
+{
+    LCD_adjust_backlight( 255 );
+}
+
+void LCD_turn_off_backlight( void )
+{
+    LCD_adjust_backlight( 0 );
+}
+
+void initialize_LCD( void )
+{
+
+    initialize_SSP0();
+
+    /* Configure the P1.21 pin as output to handle the Chip Select
+     * input pin of the LCD, which is low-level active
+     */
+    FIO1DIR |= 1<<21;
+
+    /* Configure the P3.25 pin as output to handle the Reset input of
+     * the LCD, which is low-level active
+     */
+    FIO3DIR |= 1<<25;
+
+    LCD_initialize_pwm_backlight();
+
+    LCD_maximum_backlight();
+
+    // Make LCD hardware reset
+    LCD_CS_0;
+    LCD_RESET_0;
+    delay( 10000 );
+    LCD_RESET_1;
+    delay( 10000 );
+    LCD_CS_1;
+
+    LCD_command( DISCTL );
+    LCD_datum( 0x00 );
+    LCD_datum( 0x20 );
+    LCD_datum( 0x0C );
+    LCD_datum( 0x00 );
+
+    LCD_command( OSCON );
+    delay( 10000);
+
+    LCD_command( SLPOUT );
+
+    LCD_command( VOLCTR );
+    LCD_datum( 0x24 );
+    LCD_datum( 0x03 );
+
+    LCD_command( DISINV );
+
+    LCD_command( COMSCN );
+    LCD_datum( 0x01 );
+
+    LCD_command( PWRCTR );
+    LCD_datum( 0x0F );
+    delay( 10000 );
+
+    LCD_color_mode( COLOR_12BIT );
+
+    LCD_command(DISON);
+}
+
+void LCD_color_mode( unsigned char mode )
+{
+    if( mode == COLOR_8BIT )
+        LCD_set_palette( palette.red, palette.green, palette.blue );
+
+    // Normal scan, RGB arrangement and the gray-scale setup of the mode
+    LCD_command( DATCTL );
+    LCD_datum( 0x01 );
+    LCD_datum( 0x00 );
+    LCD_datum( (mode == COLOR_8BIT) ? 0x01 : 0x02 );
+
+    palette.enabled = (mode == COLOR_8BIT);
+    glyph_cache_invalidate();
+}
+
+void LCD_set_palette( const unsigned char *red, const unsigned char *green, const unsigned char *blue )
+{
+    int i;
+
+    LCD_burst_begin();
+    LCD_burst_command( RGBSET8 );
+
+    for( i = 0; i < 8; i++ )
+    {
+        palette.red[i] = red[i] & 0xF;
+        LCD_burst_datum( palette.red[i] );
+    }
+    for( i = 0; i < 8; i++ )
+    {
+        palette.green[i] = green[i] & 0xF;
+        LCD_burst_datum( palette.green[i] );
+    }
+    for( i = 0; i < 4; i++ )
+    {
+        palette.blue[i] = blue[i] & 0xF;
+        LCD_burst_datum( palette.blue[i] );
+    }
+
+    LCD_burst_end();
+
+    nearest_levels( palette.red_index, palette.red, 8 );
+    nearest_levels( palette.green_index, palette.green, 8 );
+    nearest_levels( palette.blue_index, palette.blue, 4 );
+
+    if( palette.enabled )
+        glyph_cache_invalidate();
+}
+
+/// Print a character with a font known at compile time
+template <class Font>
+static void print_font_character( char c, int x, int y, int size, int color, int background_color )
+{
+    const unsigned char *data;
+
+    if( !clip_visible( x, y, x + Font::rows - 1, y + Font::columns - 1 ) ) return;
+
+#if LCD_GLYPH_CACHE_ENTRIES > 0
+    glyph_cache_pin = glyph_cache_clock;
+    data = cached_glyph( c, size, color, background_color );
+#else
+    unsigned char glyph[GLYPH_BYTES];
+
+    pack_font_glyph<Font>( glyph, c, color, background_color );
+    data = glyph;
+#endif
+
+    window_begin( x, y, x + Font::rows - 1, y + Font::columns - 1 );
+    write_packed( data, (Font::columns * Font::rows) / 2 );
+    window_end();
+}
+
+#if LCD_GLYPH_CACHE_ENTRIES > 0
+/// Check if the first count characters of a string fit in the glyph cache at once
+static int glyphs_fit_cache( const char *str, unsigned int count )
+{
+    unsigned int i, j, different = 0;
+
+    for( i = 0; i < count; i++ )
+    {
+        for( j = 0; j < i && str[j] != str[i]; j++ );
+
+        if( j == i && ++different > LCD_GLYPH_CACHE_ENTRIES )
+            return 0;
+    }
+
+    return 1;
+}
+#endif
+
+/// Print a string with a font known at compile time
+template <class Font>
+static void print_font_string( char *str, int x, int y, int size, int color, int background_color )
+{
+    /* The characters drawn start inside the clip rectangle, at most 132
+     * columns, or are the one cut at its start
+     */
+    const unsigned char *glyphs[131 / Font::columns + 2];
+    unsigned int row_bytes = pixel_bytes( Font::columns );
+    unsigned int count, cached, visible, columns, i, k;
+    int j;
+    unsigned char PixelRow;
+
+    if( x > clip.x1 || x + Font::rows - 1 < clip.x0 || y > clip.y1 ) return;
+
+    // Skip the characters before the clip rectangle
+    while( *str && y + Font::columns - 1 < clip.y0 )
+    {
+        str++;
+        y += Font::columns;
+    }
+
+    // The characters starting inside the clip rectangle, the last one may be cut
+    visible = clip.y1 + 1 - y;
+    for( count = 0; str[count] && count < sizeof( glyphs ) / sizeof( glyphs[0] ) &&
+                    count * Font::columns < visible; count++ );
+    if( count == 0 ) return;
+    if( count * Font::columns < visible ) visible = count * Font::columns;
+
+    /* Take the glyphs from the cache if they all fit in it at once,
+     * without replacing any glyph of this same string. Otherwise they
+     * are expanded from the font bits, without packing any of them
+     */
+    cached = 0;
+#if LCD_GLYPH_CACHE_ENTRIES > 0
+    if( glyphs_fit_cache( str, count ) )
+    {
+        glyph_cache_pin = glyph_cache_clock;
+        while( cached < count &&
+               (glyphs[cached] = cached_glyph( str[cached], size, color, background_color )) )
+            cached++;
+    }
+#endif
+
+    // A single window for the whole string, sent row by row
+    window_begin( x, y, x + Font::rows - 1, y + visible - 1 );
+
+    for( i = 0; i < Font::rows; i++ )
+    {
+        for( k = 0; k < count; k++ )
+        {
+            columns = visible - k * Font::columns;
+
+            if( cached == count && columns >= Font::columns )
+            {
+                write_packed( glyphs[k] + i * row_bytes, Font::columns / 2 );
+                continue;
+            }
+
+            PixelRow = Font::row( str[k], Font::rows - 1 - i );
+
+            if( columns >= Font::columns )
+                for( j = 0; j < Font::columns; j++ )
+                    write_pixel( (PixelRow & (0x80 >> j)) ? color : background_color );
+            else
+                for( j = 0; j < (int)columns; j++ )
+                    write_pixel( (PixelRow & (0x80 >> j)) ? color : background_color );
+        }
+    }
+
+    window_end();
+}
+
+void LCD_print_character( char c, int x, int y, int size, int color, int background_color )
+{
+    if( record( LIST_CHARACTER, c, x, y, size, color, background_color ) ) return;
+
+    switch( size )
+    {
+    case SMALL_FONT:
+        print_font_character<font_6x8>( c, x, y, size, color, background_color );
+        break;
+    case MEDIUM_FONT:
+        print_font_character<font_8x8>( c, x, y, size, color, background_color );
+        break;
+    case BIG_FONT:
+        print_font_character<font_8x16>( c, x, y, size, color, background_color );
+        break;
+    }
+}
+
+void LCD_print_string( char *str, int x, int y, int size, int color, int background_color )
+{
+    if( record( LIST_STRING, x, y, size, color, background_color ) )
+    {
+        record_string( str );
+        return;
+    }
+
+    switch( size )
+    {
+    case SMALL_FONT:
+        print_font_string<font_6x8>( str, x, y, size, color, background_color );
+        break;
+    case MEDIUM_FONT:
+        print_font_string<font_8x8>( str, x, y, size, color, background_color );
+        break;
+    case BIG_FONT:
+        print_font_string<font_8x16>( str, x, y, size, color, background_color );
+        break;
+    }
+}
+
+int LCD_font_width( int size )
+{
+    switch( size )
+    {
+    case SMALL_FONT: return font_6x8::columns;
+    case MEDIUM_FONT: return font_8x8::columns;
+    case BIG_FONT: return font_8x16::columns;
+    }
+
+    return 0;
+}
+
+int LCD_font_height( int size )
+{
+    switch( size )
+    {
+    case SMALL_FONT: return font_6x8::rows;
+    case MEDIUM_FONT: return font_8x8::rows;
+    case BIG_FONT: return font_8x16::rows;
+    }
+
+    return 0;
+}
+
+/** Decode the next character of a UTF-8 string
+ * Malformed and overlong sequences, surrogates and characters beyond the
+ * 16-bit range give the replacement character U+FFFD, so they are drawn
+ * with the default glyph of fonts that do not have it
+ */
+static unsigned int utf8_next( const char **str )
+{
+    // Smallest codepoint of each sequence length, the shorter ones are overlong
+    static const unsigned int minimum[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+    const unsigned char *p = (const unsigned char *)*str;
+    unsigned int codepoint;
+    int length, i;
+
+    if( p[0] < 0x80 )
+    {
+        *str += 1;
+        return p[0];
+    }
+
+    if( (p[0] & 0xE0) == 0xC0 ) { codepoint = p[0] & 0x1F; length = 2; }
+    else if( (p[0] & 0xF0) == 0xE0 ) { codepoint = p[0] & 0x0F; length = 3; }
+    else if( (p[0] & 0xF8) == 0xF0 ) { codepoint = p[0] & 0x07; length = 4; }
+    else
+    {
+        *str += 1;
+        return 0xFFFD;
+    }
+
+    for( i = 1; i < length; i++ )
+    {
+        if( (p[i] & 0xC0) != 0x80 )
+        {
+            *str += i;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (p[i] & 0x3F);
+    }
+
+    *str += length;
+
+    if( codepoint < minimum[length] || codepoint > 0xFFFF ||
+        (codepoint >= 0xD800 && codepoint <= 0xDFFF) )
+        return 0xFFFD;
+
+    return codepoint;
+}
+
+/// Find the glyph of a codepoint by binary search, or the default glyph
+static unsigned int font_glyph( const struct LCD_font *font, unsigned int codepoint )
+{
+    unsigned int low = 0, high = font->count, middle;
+
+    while( low < high )
+    {
+        middle = (low + high) / 2;
+
+        if( font->codepoints[middle] < codepoint )
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    if( low < font->count && font->codepoints[low] == codepoint )
+        return low;
+
+    return font->default_glyph;
+}
+
+int LCD_print_text( const char *str, int x, int y, const struct LCD_font *font,
+                    int color, int background_color )
+{
+    /* The glyphs drawn start inside the clip rectangle, at most 132
+     * columns of at least one pixel, or are the one cut at its start
+     */
+    unsigned short glyphs[133];
+    unsigned int count, visible, total, columns, width, row_bytes, glyph, i, k, j;
+    const unsigned char *row;
+    const char *next;
+
+    if( record( LIST_TEXT, x, y, color, background_color ) )
+    {
+        record_pointer( font );
+        record_string( str );
+        return 0;
+    }
+
+    if( x > clip.x1 || x + font->height - 1 < clip.x0 || y > clip.y1 ) return 0;
+
+    // Skip the glyphs before the clip rectangle
+    while( *str )
+    {
+        next = str;
+        width = font->widths[font_glyph( font, utf8_next( &next ) )];
+        if( y + (int)width > clip.y0 ) break;
+
+        str = next;
+        y += width;
+    }
+
+    // The glyphs starting inside the clip rectangle, the last one may be cut
+    visible = clip.y1 + 1 - y;
+    count = 0;
+    total = 0;
+    while( *str && total < visible && count < sizeof( glyphs ) / sizeof( glyphs[0] ) )
+    {
+        glyph = font_glyph( font, utf8_next( &str ) );
+        if( font->widths[glyph] == 0 ) continue;
+
+        glyphs[count++] = glyph;
+        total += font->widths[glyph];
+    }
+    if( count == 0 ) return 0;
+    if( total < visible ) visible = total;
+
+    // A single window for the whole text, sent row by row from the bottom
+    window_begin( x, y, x + font->height - 1, y + visible - 1 );
+
+    for( i = 0; i < font->height; i++ )
+    {
+        columns = visible;
+
+        for( k = 0; k < count && columns; k++ )
+        {
+            width = font->widths[glyphs[k]];
+            row_bytes = (width + 7) / 8;
+            row = font->bitmaps + font->offsets[glyphs[k]] + (font->height - 1 - i) * row_bytes;
+
+            for( j = 0; j < width && columns; j++, columns-- )
+                write_pixel( (row[j >> 3] & (0x80 >> (j & 7))) ? color : background_color );
+        }
+    }
+
+    window_end();
+
+    return visible;
+}
+
+int LCD_text_width( const char *str, const struct LCD_font *font )
+{
+    int width = 0;
+
+    while( *str )
+        width += font->widths[font_glyph( font, utf8_next( &str ) )];
+
+    return width;
+}
+
+void delay( volatile unsigned int t )
+{
+  while(t--);
+}
+
+void LCD_clear( void )
+{
+    if( record( LIST_CLEAR ) ) return;
+
+    window_begin( 0, 0, 131, 131 );
+    write_pixels( WHITE, 132 * 132 );
+    window_end();
+}
+
+void LCD_pixel( int x, int y, int color )
+{
+    if( record( LIST_PIXEL, x, y, color ) ) return;
+
+    window_begin( x, y, x, y );
+    write_pixel( color );
+    window_end();
+}
+
+/// Cohen-Sutherland code of the sides of the clip rectangle a point is beyond
+static int outcode( int x, int y )
+{
+    int code = 0;
+
+    if( x < clip.x0 ) code |= 1;
+    else if( x > clip.x1 ) code |= 2;
+
+    if( y < clip.y0 ) code |= 4;
+    else if( y > clip.y1 ) code |= 8;
+
+    return code;
+}
+
+/** Bresenham stepping of a line from its first end along the major axis
+ * At step k the line is k pixels along the major axis and
+ * (2 b k + a) / (2 a) pixels along the minor one, which is where the
+ * decision value of LCD_line() puts it. The products are 64-bit so that
+ * lines far beyond the screen do not overflow.
+ */
+struct line_steps
+{
+    int x, y;   ///< First end, the one with the smaller major coordinate
+    int incr;   ///< Direction along the minor axis
+    int a, b;   ///< Lengths along the major and minor axes
+    int steep;  ///< The major axis is Y
+};
+
+/// Pixels along the minor axis at a step
+static int line_minor( const struct line_steps *l, int k )
+{
+    return (int)((2LL * l->b * k + l->a) / (2LL * l->a));
+}
+
+/// First step at least m pixels along the minor axis
+static int line_first( const struct line_steps *l, int m )
+{
+    if( m <= 0 ) return 0;
+
+    return (int)((2LL * l->a * m - l->a + 2LL * l->b - 1) / (2LL * l->b));
+}
+
+/// Last step at most m pixels along the minor axis
+static int line_last( const struct line_steps *l, int m )
+{
+    long long k;
+
+    if( m < 0 ) return -1;
+
+    k = (2LL * l->a * m + l->a - 1) / (2LL * l->b);
+    return (k < l->a) ? (int)k : l->a;
+}
+
+/// Cohen-Sutherland code of the pixel at a step
+static int line_outcode( const struct line_steps *l, int k )
+{
+    int minor = l->incr * line_minor( l, k );
+
+    return l->steep ? outcode( l->x + minor, l->y + k ) :
+                      outcode( l->x + k, l->y + minor );
+}
+
+/** Clip a line to the first and last steps inside the clip rectangle
+ * Cohen-Sutherland: while an end is outside, it is moved to the side it
+ * is beyond. The sides are reached at the pixels Bresenham draws there,
+ * so the clipped line keeps the same pixels.
+ * \param k0 First step, 0 on entry
+ * \param k1 Last step, the major length on entry
+ * \return 0 if no pixel of the line is inside
+ */
+static int line_clip( const struct line_steps *l, int *k0, int *k1 )
+{
+    int code0, code1, code, side, major, k;
+
+    code0 = line_outcode( l, *k0 );
+    code1 = line_outcode( l, *k1 );
+
+    while( code0 | code1 )
+    {
+        if( code0 & code1 ) return 0;
+
+        code = code0 ? code0 : code1;
+
+        // Pixels from the first end to the side along one axis
+        if( code & 3 )
+        {
+            side = ((code & 1) ? clip.x0 : clip.x1) - l->x;
+            major = !l->steep;
+        }
+        else
+        {
+            side = ((code & 4) ? clip.y0 : clip.y1) - l->y;
+            major = l->steep;
+        }
+
+        if( code0 )
+        {
+            k = major ? side : line_first( l, side * l->incr );
+            *k0 = k;
+        }
+        else
+        {
+            k = major ? side : line_last( l, side * l->incr );
+            *k1 = k;
+        }
+
+        if( *k0 > *k1 ) return 0;
+
+        if( code0 )
+            code0 = line_outcode( l, k );
+        else
+            code1 = line_outcode( l, k );
+    }
+
+    return 1;
+}
+
+/// Draw the steps k0 to k1 of a line, m pixels along the minor axis
+static void line_run( const struct line_steps *l, int k0, int k1, int m, int color )
+{
+    if( l->steep )
+        fill_rectangle( l->x + l->incr * m, l->y + k0, l->x + l->incr * m, l->y + k1, color );
+    else
+        fill_rectangle( l->x + k0, l->y + l->incr * m, l->x + k1, l->y + l->incr * m, color );
+}
+
+void LCD_line( int x1, int y1, int x2, int y2, int color )
+{
+    struct line_steps line;
+    int   d, dx, dy;
+    int   Aincr, Bincr;
+    int   k, k0, k1, m;
+    int   temp;
+    int   start;
+
+    if( record( LIST_LINE, x1, y1, x2, y2, color ) ) return;
+
+    // Horizontal and vertical lines are a single window
+    if( x1 == x2 || y1 == y2 )
+    {
+        fill_rectangle( (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+                        (x1 > x2) ? x1 : x2, (y1 > y2) ? y1 : y2, color );
+        return;
+    }
+
+    dx = x2 - x1;
+    if( dx < 0 ) dx = -dx;
+
+    dy = y2 - y1;
+    if( dy < 0 ) dy = -dy;
+
+    if( (dx >= dy) ? (x1 > x2) : (y1 > y2) )
+    {
+        temp = x1;
+        x1 = x2;
+        x2 = temp;
+
+        temp = y1;
+        y1 = y2;
+        y2 = temp;
+    }
+
+    line.x = x1;
+    line.y = y1;
+    line.steep = dx < dy;
+    line.a = line.steep ? dy : dx;
+    line.b = line.steep ? dx : dy;
+    if( line.steep )
+        line.incr = (x2 > x1) ? 1 : -1;
+    else
+        line.incr = (y2 > y1) ? 1 : -1;
+
+    k0 = 0;
+    k1 = line.a;
+    if( !line_clip( &line, &k0, &k1 ) ) return;
+
+    transfer_begin();
+
+    /* Bresenham from the first step inside, with the decision value it
+     * has there when stepping from the first end. The consecutive pixels
+     * that share a row or a column are sent as one window.
+     */
+    m = line_minor( &line, k0 );
+    d = (int)(2LL * line.b * (k0 + 1) - line.a - 2LL * line.a * m);
+
+    Aincr = 2 * (line.b - line.a);
+    Bincr = 2 * line.b;
+
+    start = k0;
+
+    for( k = k0 + 1; k <= k1; k++ )
+    {
+        if( d >= 0 )
+        {
+            line_run( &line, start, k - 1, m, color );
+            start = k;
+
+            m++;
+            d += Aincr;
+        }
+        else
+            d += Bincr;
+    }
+
+    line_run( &line, start, k1, m, color );
+
+    transfer_end();
+}
+
+void LCD_rectangle(int x0, int y0, int x1, int y1, unsigned char fill, int color )
+{
+    int xmin, xmax, ymin, ymax;
+
+    if( record( LIST_RECTANGLE, x0, y0, x1, y1, fill, color ) ) return;
+
+    xmin = (x0 <= x1) ? x0 : x1;
+    xmax = (x0 > x1) ? x0 : x1;
+    ymin = (y0 <= y1) ? y0 : y1;
+    ymax = (y0 > y1) ? y0 : y1;
+
+    if( fill )
+        fill_rectangle( xmin, ymin, xmax, ymax, color );
+    else if( clip_visible( xmin, ymin, xmax, ymax ) )
+    {
+        // Four spans, the last two without the corners
+        transfer_begin();
+
+        fill_rectangle( xmin, ymin, xmax, ymin, color );
+        if( ymax > ymin )
+            fill_rectangle( xmin, ymax, xmax, ymax, color );
+
+        if( ymax - ymin > 1 )
+        {
+            fill_rectangle( xmin, ymin + 1, xmin, ymax - 1, color );
+            if( xmax > xmin )
+                fill_rectangle( xmax, ymin + 1, xmax, ymax - 1, color );
+        }
+
+        transfer_end();
+    }
+}
+
+void LCD_circumference( int x0, int y0, int radius, int color )
+{
+    int f = 1 - radius;
+    int ddF_x = 0;
+    int ddF_y = -2*radius;
+    int x = 0;
+    int y = radius;
+
+    if( record( LIST_CIRCUMFERENCE, x0, y0, radius, color ) ) return;
+    if( !clip_visible( x0 - radius, y0 - radius, x0 + radius, y0 + radius ) ) return;
+
+    transfer_begin();
+
+    LCD_pixel( x0, y0 + radius, color );
+    LCD_pixel( x0, y0 - radius, color );
+    LCD_pixel( x0 + radius, y0, color );
+    LCD_pixel( x0 - radius, y0, color );
+
+    while( x < y )
+    {
+        if( f >= 0 )
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        x++;
+        ddF_x += 2;
+        f += ddF_x + 1;
+
+        LCD_pixel( x0 + x, y0 + y, color );
+        LCD_pixel( x0 - x, y0 + y, color );
+        LCD_pixel( x0 + x, y0 - y, color );
+        LCD_pixel( x0 - x, y0 - y, color );
+        LCD_pixel( x0 + y, y0 + x, color );
+        LCD_pixel( x0 - y, y0 + x, color );
+        LCD_pixel( x0 + y, y0 - x, color );
+        LCD_pixel( x0 - y, y0 - x, color );
+    }
+
+    transfer_end();
+}
+
+void LCD_circle( int x0, int y0, int radius, unsigned char fill, int color )
+{
+    int f = 1 - radius;
+    int ddF_x = 0;
+    int ddF_y = -2*radius;
+    int x = 0;
+    int y = radius;
+
+    if( record( LIST_CIRCLE, x0, y0, radius, fill, color ) ) return;
+
+    if( !fill )
+    {
+        LCD_circumference( x0, y0, radius, color );
+        return;
+    }
+
+    if( !clip_visible( x0 - radius, y0 - radius, x0 + radius, y0 + radius ) ) return;
+
+    transfer_begin();
+
+    fill_rectangle( x0, y0 - radius, x0, y0 + radius, color );
+
+    /* Same steps as LCD_circumference(). The rows x0 +- x are as wide as
+     * y, and the rows x0 +- y as wide as the last x before y changes.
+     */
+    while( x < y )
+    {
+        if( f >= 0 )
+        {
+            fill_rectangle( x0 + y, y0 - x, x0 + y, y0 + x, color );
+            fill_rectangle( x0 - y, y0 - x, x0 - y, y0 + x, color );
+
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        x++;
+        ddF_x += 2;
+        f += ddF_x + 1;
+
+        if( x <= y )
+        {
+            fill_rectangle( x0 + x, y0 - y, x0 + x, y0 + y, color );
+            fill_rectangle( x0 - x, y0 - y, x0 - x, y0 + y, color );
+        }
+    }
+
+    transfer_end();
+}
+
+void LCD_ellipse( int x0, int y0, int x_radius, int y_radius, unsigned char fill, int color )
+{
+    if( record( LIST_ELLIPSE, x0, y0, x_radius, y_radius, fill, color ) ) return;
+
+    draw_quadrants( x0, y0, x0, y0, x_radius, y_radius, fill, color );
+}
+
+void LCD_rounded_rectangle( int x0, int y0, int x1, int y1, int radius, unsigned char fill, int color )
+{
+    int xmin, xmax, ymin, ymax;
+
+    if( record( LIST_ROUNDED_RECTANGLE, x0, y0, x1, y1, radius, fill, color ) ) return;
+
+    xmin = (x0 <= x1) ? x0 : x1;
+    xmax = (x0 > x1) ? x0 : x1;
+    ymin = (y0 <= y1) ? y0 : y1;
+    ymax = (y0 > y1) ? y0 : y1;
+
+    // The corners cannot be bigger than half the rectangle
+    if( radius > (xmax - xmin) / 2 ) radius = (xmax - xmin) / 2;
+    if( radius > (ymax - ymin) / 2 ) radius = (ymax - ymin) / 2;
+    if( radius < 0 ) radius = 0;
+
+    draw_quadrants( xmin + radius, ymin + radius, xmax - radius, ymax - radius,
+                    radius, radius, fill, color );
+}
+
+/// Sequential reader of the pixels of an image
+struct image_reader
+{
+    const unsigned short *data; ///< Next word of the image
+    int rle;                    ///< The image is run-length encoded
+    int color;                  ///< Color of the current run
+    unsigned int remaining;     ///< Pixels left in the current run
+};
+
+/// Start reading an image, returning its width and height
+static void image_open( struct image_reader *reader, const unsigned short *image,
+                        int *width, int *height )
+{
+    *width = image[0];
+    *height = image[1];
+    reader->rle = (image[2] == IMAGE_RLE);
+    reader->data = image + 3;
+    reader->remaining = 0;
+}
+
+/** Read the next run of pixels of the same color
+ * A raw image gives runs of one pixel
+ * \return Number of pixels of the run, 0 if the image is corrupt
+ */
+static unsigned int image_run( struct image_reader *reader, int *color )
+{
+    unsigned int word = *reader->data++;
+
+    *color = word & 0xFFF;
+
+    if( !reader->rle )
+        return 1;
+
+    // Runs longer than 15 pixels take a second word with their length
+    if( (word >> 12) == 15 )
+        return *reader->data++;
+
+    return (word >> 12) + 1;
+}
+
+/** Read the next pixel of an image
+ * \return 12-bit color, or -1 if the image is corrupt
+ */
+static int image_pixel( struct image_reader *reader )
+{
+    if( reader->remaining == 0 )
+    {
+        reader->remaining = image_run( reader, &reader->color );
+        if( reader->remaining == 0 ) return -1;
+    }
+
+    reader->remaining--;
+    return reader->color;
+}
+
+void LCD_blit( int x0, int y0, int x1, int y1, const unsigned short *pixels )
+{
+    unsigned int count;
+
+    // The pixel order follows the corners, so reversed ones are not valid
+    if( x1 < x0 || y1 < y0 ) return;
+
+    if( record( LIST_BLIT, x0, y0, x1, y1 ) )
+    {
+        record_pointer( pixels );
+        return;
+    }
+
+    if( !clip_visible( x0, y0, x1, y1 ) ) return;
+    count = (x1 - x0 + 1) * (y1 - y0 + 1);
+
+    window_begin( x0, y0, x1, y1 );
+    while( count-- )
+        write_pixel( *pixels++ );
+    window_end();
+}
+
+void LCD_image( const unsigned short *image, int x, int y )
+{
+    struct image_reader reader;
+    int width, height, color;
+    unsigned int count, run;
+
+    if( record( LIST_IMAGE, x, y ) )
+    {
+        record_pointer( image );
+        return;
+    }
+
+    image_open( &reader, image, &width, &height );
+    if( !clip_visible( x, y, x + height - 1, y + width - 1 ) ) return;
+    count = width * height;
+
+    // The runs go straight to the window, so long ones are fills
+    window_begin( x, y, x + height - 1, y + width - 1 );
+
+    while( count )
+    {
+        // A run of 0 pixels is not valid: stop before reading past the image
+        run = image_run( &reader, &color );
+        if( run == 0 ) break;
+        if( run > count ) run = count;
+
+        write_pixels( color, run );
+        count -= run;
+    }
+
+    window_end();
+}
+
+void LCD_sprite( const unsigned short *image, int x, int y, int key_color )
+{
+    struct image_reader reader;
+    unsigned short row[132];
+    int width, height, i, j, start, color;
+
+    if( record( LIST_SPRITE, x, y, key_color ) )
+    {
+        record_pointer( image );
+        return;
+    }
+
+    image_open( &reader, image, &width, &height );
+    if( width > 132 || !clip_visible( x, y, x + height - 1, y + width - 1 ) ) return;
+
+    transfer_begin();
+
+    // One window for each run of opaque pixels of a row
+    for( i = 0; i < height; i++ )
+    {
+        for( j = 0; j < width; j++ )
+        {
+            color = image_pixel( &reader );
+            if( color < 0 ) break;
+            row[j] = color;
+        }
+
+        // A corrupt image stops at the last whole row
+        if( j < width ) break;
+
+        j = 0;
+        while( j < width )
+        {
+            if( row[j] == key_color )
+            {
+                j++;
+                continue;
+            }
+
+            start = j;
+            while( j < width && row[j] != key_color )
+                j++;
+
+            window_begin( x + i, y + start, x + i, y + j - 1 );
+            for( ; start < j; start++ )
+                write_pixel( row[start] );
+            window_end();
+        }
+    }
+
+    transfer_end();
+}
+
+void LCD_set_clip( int x0, int y0, int x1, int y1 )
+{
+    if( record( LIST_CLIP, x0, y0, x1, y1 ) ) return;
+
+    clip.x0 = (x0 < x1) ? x0 : x1;
+    clip.y0 = (y0 < y1) ? y0 : y1;
+    clip.x1 = (x0 < x1) ? x1 : x0;
+    clip.y1 = (y0 < y1) ? y1 : y0;
+
+    if( clip.x0 < 0 ) clip.x0 = 0;
+    if( clip.y0 < 0 ) clip.y0 = 0;
+    if( clip.x1 > 131 ) clip.x1 = 131;
+    if( clip.y1 > 131 ) clip.y1 = 131;
+
+    // While drawing a band the clip rectangle is kept inside it
+    if( display_list.replaying )
+    {
+        display_list.last_clip = clip;
+        if( clip.x0 < framebuffer_x0 ) clip.x0 = framebuffer_x0;
+        if( clip.x1 > framebuffer_x1 ) clip.x1 = framebuffer_x1;
+    }
+}
+
+void LCD_reset_clip( void )
+{
+    LCD_set_clip( 0, 0, 131, 131 );
+}
 
-        x++;
-        ddF_x += 2;
-        f += ddF_x + 1;
+void LCD_framebuffer_enable( unsigned char *buffer )
+{
+    framebuffer = buffer;
+    shown = 0;
+    dirty_count = 0;
+}
 
-        LCD_pixel( x0 + x, y0 + y, color );
-        LCD_pixel( x0 - x, y0 + y, color );
-        LCD_pixel( x0 + x, y0 - y, color );
-        LCD_pixel( x0 - x, y0 - y, color );
-        LCD_pixel( x0 + y, y0 + x, color );
-        LCD_pixel( x0 - y, y0 + x, color );
-        LCD_pixel( x0 + y, y0 - x, color );
-        LCD_pixel( x0 - y, y0 - x, color );
+void LCD_double_buffer_enable( unsigned char *buffer, unsigned char *copy )
+{
+    framebuffer = buffer;
+    shown = copy;
+    shown_valid = 0;
+    dirty_count = 0;
+}
+
+void LCD_framebuffer_disable( void )
+{
+    LCD_flush();
+    framebuffer = 0;
+    shown = 0;
+}
+
+/// Send a rectangle of the framebuffer, widened to whole pixel pairs
+static void send_framebuffer( const struct rectangle *r )
+{
+    int x, y, y0, y1;
+    unsigned int bytes;
+
+    // Align the columns to whole pixel pairs so each framebuffer
+    // row can be sent as it is
+    y0 = r->y0 & ~1;
+    y1 = r->y1 | 1;
+    bytes = ((y1 - y0 + 1) / 2) * 3;
+
+    LCD_burst_command( PASET );
+    LCD_burst_datum( r->x0 );
+    LCD_burst_datum( r->x1 );
+
+    LCD_burst_command( CASET );
+    LCD_burst_datum( y0 );
+    LCD_burst_datum( y1 );
+
+    LCD_burst_command( RAMWR );
+
+    for( x = r->x0; x <= r->x1; x++ )
+    {
+        if( !palette.enabled )
+        {
+            LCD_burst_data( framebuffer + (x - framebuffer_x0) * FRAMEBUFFER_ROW + (y0 >> 1) * 3, bytes );
+            continue;
+        }
+
+        for( y = y0; y <= y1; y++ )
+            LCD_burst_datum( color_index( framebuffer_color( x, y ) ) );
+    }
+}
+
+void LCD_flush( void )
+{
+    int i;
+
+    if( !framebuffer ) return;
+
+    if( shown )
+    {
+        LCD_swap();
+        return;
+    }
+
+    LCD_burst_begin();
+
+    for( i = 0; i < dirty_count; i++ )
+        send_framebuffer( &dirty[i] );
+
+    LCD_burst_end();
+
+    dirty_count = 0;
+}
+
+/** Check if the bytes of a 4-byte word inside [start, end) differ from
+ * the screen copy
+ * The bytes are compared with memcmp(), so the buffers need no alignment
+ */
+static int word_differs( unsigned int word, unsigned int start, unsigned int end )
+{
+    unsigned int i;
+
+    if( word * 4 >= start && word * 4 + 4 <= end )
+        return memcmp( framebuffer + word * 4, shown + word * 4, 4 ) != 0;
+
+    // The word is shared with the next or previous row
+    for( i = word * 4; i < word * 4 + 4; i++ )
+        if( i >= start && i < end && framebuffer[i] != shown[i] )
+            return 1;
+
+    return 0;
+}
+
+unsigned long LCD_swap( void )
+{
+    struct rectangle span = { 0, 0, 131, 131 };
+    unsigned long bytes = 0;
+    unsigned int start, end, word, end_word, last, first, offset, stop, length;
+    int x, i;
+
+    if( !framebuffer || !shown ) return 0;
+
+    LCD_burst_begin();
+
+    if( !shown_valid )
+    {
+        send_framebuffer( &span );
+        memcpy( shown, framebuffer, LCD_FRAMEBUFFER_SIZE );
+        bytes = 7 + pixel_bytes( 132 * 132 );
+        shown_valid = 1;
+    }
+    else for( x = 0; x < 132; x++ )
+    {
+        // Only the rows drawn since the last swap can have changed
+        for( i = 0; i < dirty_count; i++ )
+            if( x >= dirty[i].x0 && x <= dirty[i].x1 )
+                break;
+        if( i == dirty_count ) continue;
+
+        start = x * FRAMEBUFFER_ROW;
+        end = start + FRAMEBUFFER_ROW;
+
+        // Rows drawn again the same are skipped at once
+        if( !memcmp( framebuffer + start, shown + start, FRAMEBUFFER_ROW ) ) continue;
+        word = start / 4;
+        end_word = (end + 3) / 4;
+
+        while( word < end_word )
+        {
+            if( !word_differs( word, start, end ) )
+            {
+                word++;
+                continue;
+            }
+
+            // Extend the span over short runs of equal words
+            first = last = word;
+            for( word++; word < end_word && word - last <= SWAP_GAP_WORDS; word++ )
+                if( word_differs( word, start, end ) )
+                    last = word;
+
+            // Widen the span to whole pixel pairs of the row
+            offset = (first * 4 > start) ? first * 4 - start : 0;
+            stop = (last * 4 + 4 < end) ? last * 4 + 4 - start : FRAMEBUFFER_ROW;
+            offset -= offset % 3;
+            length = (stop + 2) / 3 * 3 - offset;
+
+            span.x0 = span.x1 = x;
+            span.y0 = (offset / 3) * 2;
+            span.y1 = span.y0 + (length / 3) * 2 - 1;
+            send_framebuffer( &span );
+
+            memcpy( shown + start + offset, framebuffer + start + offset, length );
+            bytes += 7 + pixel_bytes( span.y1 - span.y0 + 1 );
+        }
+    }
+
+    LCD_burst_end();
+
+    dirty_count = 0;
+
+    return bytes;
+}
+
+/// Read a 16-bit argument of a display list entry
+static int list_short( const unsigned char **p )
+{
+    short value;
+
+    memcpy( &value, *p, sizeof value );
+    *p += sizeof value;
+    return value;
+}
+
+/// Read a pointer argument of a display list entry
+static const void *list_pointer( const unsigned char **p )
+{
+    const void *pointer;
+
+    memcpy( &pointer, *p, sizeof pointer );
+    *p += sizeof pointer;
+    return pointer;
+}
+
+/** Check if a display list entry can draw on the rows held by the
+ * framebuffer, so that the bands it misses skip it without decoding it
+ */
+static int list_entry_in_band( int op, const int *a, const void *pointer )
+{
+    int x0, x1, swap;
+
+    switch( op )
+    {
+    case LIST_PIXEL:
+        x0 = x1 = a[0];
+        break;
+    case LIST_LINE:
+    case LIST_RECTANGLE:
+    case LIST_ROUNDED_RECTANGLE:
+    case LIST_BLIT:
+    case LIST_DMA_BLIT:
+        x0 = a[0];
+        x1 = a[2];
+        break;
+    case LIST_CIRCUMFERENCE:
+    case LIST_CIRCLE:
+    case LIST_ELLIPSE:
+        x0 = a[0] - a[2];
+        x1 = a[0] + a[2];
+        break;
+    case LIST_CHARACTER:
+        x0 = a[1];
+        x1 = a[1] + LCD_font_height( a[3] ) - 1;
+        break;
+    case LIST_STRING:
+        x0 = a[0];
+        x1 = a[0] + LCD_font_height( a[2] ) - 1;
+        break;
+    case LIST_TEXT:
+        x0 = a[0];
+        x1 = a[0] + ((const struct LCD_font *)pointer)->height - 1;
+        break;
+    case LIST_IMAGE:
+    case LIST_SPRITE:
+        x0 = a[0];
+        x1 = a[0] + ((const unsigned short *)pointer)[1] - 1;
+        break;
+    default:
+        // LCD_clear() covers every band, and clip changes must always be kept
+        return 1;
+    }
+
+    if( x0 > x1 )
+    {
+        swap = x0;
+        x0 = x1;
+        x1 = swap;
+    }
+
+    return x1 >= framebuffer_x0 && x0 <= framebuffer_x1;
+}
+
+/// Draw the entries of the display list
+static void replay( void )
+{
+    const unsigned char *p = display_list.buffer;
+    const unsigned char *end = display_list.buffer + display_list.length;
+    const void *pointer;
+    const char *str;
+    int a[7];
+    int op, i;
+
+    while( p < end )
+    {
+        op = *p++;
+        for( i = 0; i < list_arguments[op]; i++ )
+            a[i] = list_short( &p );
+
+        pointer = 0;
+        if( op == LIST_TEXT || op == LIST_BLIT || op == LIST_IMAGE ||
+            op == LIST_SPRITE || op == LIST_DMA_BLIT )
+            pointer = list_pointer( &p );
+
+        str = 0;
+        if( op == LIST_STRING || op == LIST_TEXT )
+        {
+            str = (const char *)p;
+            p += strlen( str ) + 1;
+        }
+
+        // Nothing is drawn while the clip rectangle is outside the band
+        if( op != LIST_CLIP && clip.x0 > clip.x1 )
+            continue;
+
+        if( !list_entry_in_band( op, a, pointer ) )
+            continue;
+
+        switch( op )
+        {
+        case LIST_CLEAR:
+            LCD_clear();
+            break;
+        case LIST_PIXEL:
+            LCD_pixel( a[0], a[1], a[2] );
+            break;
+        case LIST_LINE:
+            LCD_line( a[0], a[1], a[2], a[3], a[4] );
+            break;
+        case LIST_RECTANGLE:
+            LCD_rectangle( a[0], a[1], a[2], a[3], a[4], a[5] );
+            break;
+        case LIST_CIRCUMFERENCE:
+            LCD_circumference( a[0], a[1], a[2], a[3] );
+            break;
+        case LIST_CIRCLE:
+            LCD_circle( a[0], a[1], a[2], a[3], a[4] );
+            break;
+        case LIST_ELLIPSE:
+            LCD_ellipse( a[0], a[1], a[2], a[3], a[4], a[5] );
+            break;
+        case LIST_ROUNDED_RECTANGLE:
+            LCD_rounded_rectangle( a[0], a[1], a[2], a[3], a[4], a[5], a[6] );
+            break;
+        case LIST_CHARACTER:
+            LCD_print_character( a[0], a[1], a[2], a[3], a[4], a[5] );
+            break;
+        case LIST_STRING:
+            LCD_print_string( (char *)str, a[0], a[1], a[2], a[3], a[4] );
+            break;
+        case LIST_TEXT:
+            LCD_print_text( str, a[0], a[1], (const struct LCD_font *)pointer, a[2], a[3] );
+            break;
+        case LIST_BLIT:
+            LCD_blit( a[0], a[1], a[2], a[3], (const unsigned short *)pointer );
+            break;
+        case LIST_IMAGE:
+            LCD_image( (const unsigned short *)pointer, a[0], a[1] );
+            break;
+        case LIST_SPRITE:
+            LCD_sprite( (const unsigned short *)pointer, a[0], a[1], a[2] );
+            break;
+        case LIST_DMA_BLIT:
+            LCD_dma_blit( a[0], a[1], a[2], a[3], (const unsigned short *)pointer,
+                          (unsigned short)a[4] );
+            break;
+        case LIST_CLIP:
+            LCD_set_clip( a[0], a[1], a[2], a[3] );
+            break;
+        }
+    }
+}
+
+void LCD_record_begin( unsigned char *list, unsigned int size )
+{
+    display_list.buffer = list;
+    display_list.size = size;
+    display_list.length = 0;
+    display_list.overflow = 0;
+    display_list.replaying = 0;
+    display_list.clip = clip;
+    display_list.last_clip = clip;
+}
+
+int LCD_record_end( unsigned char *band, int background_color )
+{
+    struct rectangle whole = { 0, 0, 131, 131 };
+    unsigned char pattern[3];
+    unsigned int i;
+    int x, k;
+
+    if( !display_list.buffer ) return 0;
+
+    display_list.replaying = 1;
+
+    if( framebuffer )
+    {
+        // The framebuffer already holds the whole screen
+        clip = display_list.clip;
+        replay();
+    }
+    else
+    {
+        pattern[0] = (background_color >> 4) & 0xFF;
+        pattern[1] = ((background_color & 0xF) << 4) | ((background_color >> 8) & 0xF);
+        pattern[2] = background_color & 0xFF;
+
+        LCD_burst_begin();
+
+        // Each band is drawn over the background in the band buffer and
+        // sent whole in a single RAMWR
+        for( x = 0; x < 132; x += LCD_BAND_ROWS )
+        {
+            framebuffer = band;
+            framebuffer_x0 = x;
+            framebuffer_x1 = (x + LCD_BAND_ROWS - 1 < 131) ? x + LCD_BAND_ROWS - 1 : 131;
+
+            for( i = 0; i < (unsigned int)(framebuffer_x1 - x + 1) * FRAMEBUFFER_ROW; i += 3 )
+                for( k = 0; k < 3; k++ )
+                    band[i + k] = pattern[k];
+
+            clip = display_list.clip;
+            if( clip.x0 < framebuffer_x0 ) clip.x0 = framebuffer_x0;
+            if( clip.x1 > framebuffer_x1 ) clip.x1 = framebuffer_x1;
+
+            dirty_count = 0;
+            replay();
+
+            whole.x0 = framebuffer_x0;
+            whole.x1 = framebuffer_x1;
+            send_framebuffer( &whole );
+        }
+
+        LCD_burst_end();
+
+        framebuffer = 0;
+        framebuffer_x0 = 0;
+        framebuffer_x1 = 131;
+        dirty_count = 0;
+    }
+
+    display_list.replaying = 0;
+    display_list.buffer = 0;
+    clip = display_list.last_clip;
+
+    return display_list.overflow ? -1 : 0;
+}
+
+void LCD_scroll_area( int top, int bottom )
+{
+    // The controller scrolls blocks of 4 lines
+    if( top < 0 ) top = 0;
+    if( bottom > 131 ) bottom = 131;
+    top &= ~3;
+    bottom |= 3;
+    if( bottom > 131 ) bottom = 131;
+
+    scroll.top = top;
+    scroll.bottom = bottom;
+    scroll.offset = 0;
+
+    // Center screen scroll: the lines outside the area stay fixed
+    LCD_burst_begin();
+    LCD_burst_command( ASCSET );
+    LCD_burst_datum( top / 4 );
+    LCD_burst_datum( bottom / 4 );
+    LCD_burst_datum( bottom / 4 );
+    LCD_burst_datum( 0x00 );
+
+    LCD_burst_command( SCSTART );
+    LCD_burst_datum( top / 4 );
+    LCD_burst_end();
+}
+
+void LCD_scroll( int lines )
+{
+    int height = scroll.bottom - scroll.top + 1;
+
+    lines %= height;
+    if( lines < 0 ) lines += height;
+    scroll.offset = lines & ~3;
+
+    LCD_command( SCSTART );
+    LCD_datum( (scroll.top + scroll.offset) / 4 );
+}
+
+int LCD_scroll_row( int x )
+{
+    int height = scroll.bottom - scroll.top + 1;
+
+    if( x < scroll.top || x > scroll.bottom )
+        return x;
+
+    return scroll.top + (x - scroll.top + scroll.offset) % height;
+}
+
+void LCD_dma_enable( unsigned short *buffer, unsigned int size )
+{
+    LCD_dma_wait();
+
+    dma.buffer = buffer;
+    dma.size = size;
+    dma.pattern_color = -1;
+
+    // Set up power for the GPDMA and enable it
+    PCONP |= 1<<29;
+    DMACConfiguration = 1;
+    DMACIntTCClear = 1;
+    DMACIntErrClr = 1;
+
+    // Interruption function address and priority, above the sound one
+    VICVectAddr25 = (unsigned long)ISR_GPDMA;
+    VICVectPriority25 = 14;
+    VICIntEnable |= 1<<25;
+
+    // Let the SSP0 TX FIFO request the DMA transfers
+    SSP0DMACR = 2;
+
+    enable_IRQ();
+}
+
+void LCD_dma_disable( void )
+{
+    LCD_dma_wait();
+
+    SSP0DMACR = 0;
+    VICIntEnClr = 1<<25;
+    dma.buffer = 0;
+}
+
+void LCD_dma_callback( void (*callback)( void ) )
+{
+    dma.callback = callback;
+}
+
+int LCD_dma_busy( void )
+{
+    return dma.active;
+}
+
+void LCD_dma_wait( void )
+{
+    while( dma.active );
+}
+
+void LCD_dma_blit( int x0, int y0, int x1, int y1, const unsigned short *frames, unsigned int count )
+{
+    unsigned int i;
+
+    // The display list keeps 16-bit arguments, so bigger transfers are dropped
+    if( display_list.buffer && !display_list.replaying && count > 0xFFFF )
+    {
+        display_list.overflow = 1;
+        return;
+    }
+
+    if( record( LIST_DMA_BLIT, x0, y0, x1, y1, count ) )
+    {
+        record_pointer( frames );
+        return;
+    }
+
+    window_begin( x0, y0, x1, y1 );
+
+    if( !framebuffer && dma.buffer && !window.clipped )
+        dma_start( frames, count, DMA_MAXIMUM_TRANSFER, 1, 1 );
+    else if( palette.enabled )
+    {
+        for( i = 0; i < count; i++ )
+            write_pixel( index_color( frames[i] & 0xFF ) );
+    }
+    else
+    {
+        for( i = 0; i + 2 < count; i += 3 )
+        {
+            write_pixel( ((frames[i] & 0xFF) << 4) | ((frames[i + 1] >> 4) & 0xF) );
+            write_pixel( ((frames[i + 1] & 0xF) << 8) | (frames[i + 2] & 0xFF) );
+        }
+    }
+
+    window_end();
+}
+
+unsigned int LCD_dma_pack( unsigned short *frames, const unsigned short *pixels, unsigned int count )
+{
+    unsigned int i;
+    int color0, color1;
+
+    if( palette.enabled )
+    {
+        for( i = 0; i < count; i++ )
+            frames[i] = color_index( pixels[i] ) | 0x100;
+        return count;
+    }
+
+    for( i = 0; i < count; i += 2 )
+    {
+        color0 = pixels[i];
+        color1 = (i + 1 < count) ? pixels[i + 1] : pixels[0];
+
+        *frames++ = ((color0 >> 4) & 0xFF) | 0x100;
+        *frames++ = (((color0 & 0xF) << 4) | ((color1 >> 8) & 0xF)) | 0x100;
+        *frames++ = (color1 & 0xFF) | 0x100;
+    }
+
+    return ((count + 1) / 2) * 3;
+}
+
+void LCD_queue_enable( unsigned short *buffer, unsigned int size )
+{
+    LCD_wait_idle();
+
+    queue.buffer = buffer;
+    queue.size = size;
+    queue.head = 0;
+    queue.tail = 0;
+    LCD_queue_reset_statistics();
+
+    // Interruption function address and priority, above the sound one
+    VICVectAddr10 = (unsigned long)ISR_SSP0;
+    VICVectPriority10 = 14;
+    VICIntEnable |= 1<<10;
+
+    enable_IRQ();
+
+    LCD_CS_0;
+}
+
+void LCD_queue_disable( void )
+{
+    LCD_wait_idle();
+
+    SSP0IMSC = 0;
+    VICIntEnClr = 1<<10;
+    queue.buffer = 0;
+
+    release_bus();
+}
+
+void LCD_wait_idle( void )
+{
+    LCD_dma_wait();
+
+    if( queue.buffer )
+    {
+        while( queue.head != queue.tail );
+        while( SSP0SR & SSP0SR_BSY );
+    }
+}
+
+unsigned int LCD_queue_free( void )
+{
+    return queue.buffer ? queue.size - 1 - queue_used() : 0;
+}
+
+unsigned int LCD_queue_high_water_mark( void )
+{
+    return queue.high_water_mark;
+}
+
+unsigned long LCD_queue_stalls( void )
+{
+    return queue.stalls;
+}
+
+void LCD_queue_reset_statistics( void )
+{
+    queue.high_water_mark = 0;
+    queue.stalls = 0;
+}
+
+void ISR_SSP0( void ) /* __attribute__((interrupt ("IRQ"))) */
+{
+    unsigned int head = queue.head;
+
+    while( head != queue.tail && (SSP0SR & SSP0SR_TNF) )
+    {
+        SSP0DR = queue.buffer[head];
+        if( ++head == queue.size ) head = 0;
+    }
+
+    queue.head = head;
+
+    // Nothing is read back from the LCD
+    while( SSP0SR & SSP0SR_RNE ) (void)SSP0DR;
+    SSP0ICR = 1;
+
+    // Stop interrupting once the queue is empty
+    if( head == queue.tail )
+        SSP0IMSC = 0;
+
+    /*
+     * WARNING: if the Philips_LPC230X_Startup.s file provided by
+     * CrossStudio is being used, the following line should be present
+     * only if the symbol VECTORED_IRQ_INTERRUPTS has been defined.
+     */
+
+    VICAddress = 0;
+}
+
+void ISR_GPDMA( void ) /* __attribute__((interrupt ("IRQ"))) */
+{
+    DMACIntTCClear = 1;
+    DMACIntErrClr = 1;
+
+    if( dma.remaining )
+        dma_next_chunk();
+    else
+    {
+        if( dma.release )
+        {
+            dma.release = 0;
+            release_bus();
+        }
+
+        dma.active = 0;
+
+        if( dma.callback )
+            dma.callback();
     }
+
+    /*
+     * WARNING: if the Philips_LPC230X_Startup.s file provided by
+     * CrossStudio is being used, the following line should be present
+     * only if the symbol VECTORED_IRQ_INTERRUPTS has been defined.
+     */
+
+    VICAddress = 0;
+}
+
+void LCD_glyph_cache_statistics( unsigned long *hits, unsigned long *misses )
+{
+    *hits = glyph_cache_hits;
+    *misses = glyph_cache_misses;
+}
+
+void LCD_glyph_cache_clear( void )
+{
+    glyph_cache_invalidate();
+
+    glyph_cache_hits = 0;
+    glyph_cache_misses = 0;
 }
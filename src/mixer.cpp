@@ -0,0 +1,180 @@
+/// \file mixer.cpp Sound mixer
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <olimex-lpc2378-stk/mixer.h>
+
+/// Sample value of silence, the middle of the 10-bit DAC range
+#define SILENCE 512
+
+/// Samples mixed at a time, the size of the accumulator
+#define MIXER_CHUNK 64
+
+/// Sound playing on a voice
+struct voice
+{
+    const unsigned short *samples; ///< Samples, 0 if the voice is free
+    int count;                     ///< Number of samples
+    int position;                  ///< Next sample to mix
+    int volume;                    ///< Volume, MIXER_FULL_VOLUME as recorded
+    int priority;                  ///< Priority for the voice stealing
+    int loop;                      ///< Start again at the end
+    unsigned long started;         ///< Value of plays when the sound started
+};
+
+/** Voices, volatile because mixer_render() usually runs in the timer
+ * interruption while the application starts and stops sounds
+ */
+static volatile struct voice voices[MIXER_VOICES];
+
+/// Sounds started, to tell which voice has played the longest
+static unsigned long plays;
+
+/// Choose the voice for a new sound, -1 if none can be taken
+static int free_voice( int priority )
+{
+    int i, best = -1;
+
+    for( i = 0; i < MIXER_VOICES; i++ )
+    {
+        if( !voices[i].samples )
+            return i;
+
+        if( voices[i].priority > priority )
+            continue;
+
+        /* The lowest priority, and then the one that has played longest,
+         * which for a looping sound is not where it is in the samples
+         */
+        if( best < 0 || voices[i].priority < voices[best].priority ||
+            (voices[i].priority == voices[best].priority &&
+             voices[i].started < voices[best].started) )
+            best = i;
+    }
+
+    return best;
+}
+
+void mixer_initialize( void )
+{
+    int i;
+
+    for( i = 0; i < MIXER_VOICES; i++ )
+        voices[i].samples = 0;
+}
+
+int mixer_play( const unsigned short *samples, int count, int volume, int priority, int loop )
+{
+    int i = free_voice( priority );
+
+    if( i < 0 || count <= 0 ) return -1;
+
+    // The voice is free while it is set up, and starts when samples is set
+    voices[i].samples = 0;
+    voices[i].count = count;
+    voices[i].position = 0;
+    voices[i].volume = volume;
+    voices[i].priority = priority;
+    voices[i].loop = loop;
+    voices[i].started = ++plays;
+    voices[i].samples = samples;
+
+    return i;
+}
+
+void mixer_stop( int voice )
+{
+    if( voice >= 0 && voice < MIXER_VOICES )
+        voices[voice].samples = 0;
+}
+
+void mixer_volume( int voice, int volume )
+{
+    if( voice >= 0 && voice < MIXER_VOICES )
+        voices[voice].volume = volume;
+}
+
+int mixer_active( int voice )
+{
+    return voice >= 0 && voice < MIXER_VOICES && voices[voice].samples != 0;
+}
+
+/// Add the next samples of a voice, scaled by its volume, to the accumulator
+static void mix_voice( volatile struct voice *v, int *sum, int count )
+{
+    const unsigned short *samples = v->samples;
+    int position = v->position;
+    int volume = v->volume;
+    int run, i;
+
+    while( count )
+    {
+        run = v->count - position;
+        if( run > count ) run = count;
+
+        for( i = 0; i < run; i++ )
+            *sum++ += ((int)samples[position + i] - SILENCE) * volume;
+
+        position += run;
+        count -= run;
+
+        if( position == v->count )
+        {
+            if( !v->loop )
+            {
+                v->samples = 0;
+                return;
+            }
+            position = 0;
+        }
+    }
+
+    v->position = position;
+}
+
+void mixer_render( unsigned short *buffer, int count )
+{
+    // Static, so the refill callback does not take it from the interruption stack
+    static int sum[MIXER_CHUNK];
+    int chunk, i, value;
+
+    while( count )
+    {
+        chunk = (count > MIXER_CHUNK) ? MIXER_CHUNK : count;
+
+        for( i = 0; i < chunk; i++ )
+            sum[i] = 0;
+
+        for( i = 0; i < MIXER_VOICES; i++ )
+            if( voices[i].samples )
+                mix_voice( &voices[i], sum, chunk );
+
+        for( i = 0; i < chunk; i++ )
+        {
+            value = (sum[i] >> 8) + SILENCE;
+            if( value < 0 ) value = 0;
+            if( value > 1023 ) value = 1023;
+            *buffer++ = value;
+        }
+
+        count -= chunk;
+    }
+}
@@ -28,39 +28,197 @@
  */
 
 #include <targets/LPC2378.h>
+#include <olimex-lpc2378-stk/init.h>
 #include <olimex-lpc2378-stk/sound.h>
 
 /// Play a sample routine
 void ISR_Timer0( void ) __attribute__ ((interrupt ("IRQ")));
-/// Enable IRQs
-void enable_IRQ( void );
+/// Play a sample routine when the Timer 0 is a fast interruption
+extern "C" void fiq_handler( void ) __attribute__ ((interrupt ("FIQ")));
 
 /// Global samples array for access from the IRQ function
 const unsigned short *samples_array;
 /// Global sample counter for access from the IRQ function
-int sample_counter;
+volatile int sample_counter;
+
+/// Buffer of samples waiting in the playback queue
+struct sound_buffer
+{
+  const unsigned short *samples; ///< Samples
+  int count;                     ///< Number of samples
+};
+
+/** Playback queue
+ * The buffer at head is the one playing, and the ISR moves to the next
+ * one as soon as it ends, so the queued buffers play without gaps
+ */
+static struct
+{
+  struct sound_buffer buffers[SOUND_QUEUE_BUFFERS + 1]; ///< Ring of buffers
+  volatile int head;              ///< Buffer playing or next to play
+  volatile int tail;              ///< Where the next buffer is queued
+  volatile int playing;           ///< The buffer at head is playing
+  volatile int streaming;         ///< More buffers are expected
+  volatile int running;           ///< The timer is running
+  volatile unsigned long underruns; ///< Times the queue ran dry while streaming
+  void (*callback)( void );       ///< Called when a buffer ends and few are left
+  int low_watermark;              ///< Queued buffers at or below which the callback is called
+  struct sound_link *volatile link; ///< Link playing in chain mode, 0 otherwise
+} sound_queue = { { { 0, 0 } }, 0, 0, 0, 0, 0, 0, 0, 1, 0 };
+
+/// Number of queued buffers, the one playing included
+static int queued_buffers( void )
+{
+  int used = sound_queue.tail - sound_queue.head;
+
+  return (used < 0) ? used + SOUND_QUEUE_BUFFERS + 1 : used;
+}
+
+/// Move to the next queued buffer when the one playing has ended
+static void next_buffer( void )
+{
+  int ended = sound_queue.playing;
+  int chain_ended = 0;
+
+  if ( ended )
+  {
+    if ( sound_queue.link )
+    {
+      sound_queue.link = sound_queue.link->next;
+      chain_ended = !sound_queue.link;
+    }
+    else if ( ++sound_queue.head == SOUND_QUEUE_BUFFERS + 1 )
+      sound_queue.head = 0;
+    sound_queue.playing = 0;
+  }
+
+  if ( sound_queue.link )
+  {
+    samples_array = sound_queue.link->samples;
+    sample_counter = sound_queue.link->count;
+    sound_queue.playing = 1;
+  }
+  else if ( !chain_ended && sound_queue.head != sound_queue.tail )
+  {
+    samples_array = sound_queue.buffers[sound_queue.head].samples;
+    sample_counter = sound_queue.buffers[sound_queue.head].count;
+    sound_queue.playing = 1;
+  }
+  else if ( chain_ended || !sound_queue.streaming )
+  {
+    // Nothing else to play: the end of a chain stops whatever the queue state
+    T0TCR = 0;
+    sound_queue.running = 0;
+  }
+  else if ( ended )
+    sound_queue.underruns++;
+
+  if ( ended && sound_queue.callback && queued_buffers() <= sound_queue.low_watermark )
+    sound_queue.callback();
+}
+
+/// Play the next sample, moving to the next buffer at the end of one
+static inline void play_sample( void )
+{
+  // At the end of a buffer the next one starts in this same sample
+  if ( sample_counter == 0 )
+    next_buffer();
+
+  if ( sample_counter > 0 )
+  {
+    DACR = (*samples_array)<<6;
+    samples_array++;
+    sample_counter--;
+  }
+}
+
+/// Start the timer if it is stopped
+static void start_playback( void )
+{
+  if ( !sound_queue.running )
+  {
+    sound_queue.running = 1;
+    T0TCR = T0TCR_Counter_Enable;
+  }
+}
+
+/// Frequency of the main oscillator of the board
+#define MAIN_OSCILLATOR 12000000UL
+
+/// Frequency of the internal RC oscillator
+#define INTERNAL_OSCILLATOR 4000000UL
+
+/// Frequency of the RTC oscillator
+#define RTC_OSCILLATOR 32768UL
+
+/** Timer 0 clock, computed from the clock source, PLL, CPU clock divider
+ * and peripheral clock divider settings in effect
+ */
+static unsigned long timer0_clock ( void )
+{
+  unsigned long clock, msel, nsel;
+
+  switch ( CLKSRCSEL & 3 )
+  {
+  case 0:  clock = INTERNAL_OSCILLATOR; break;
+  case 2:  clock = RTC_OSCILLATOR; break;
+  default: clock = MAIN_OSCILLATOR; break;
+  }
+
+  // The PLL output only drives the CPU once it is enabled and connected
+  if ( (PLLSTAT & (3<<24)) == (3<<24) )
+  {
+    msel = (PLLSTAT & 0x7FFF) + 1;
+    nsel = ((PLLSTAT >> 16) & 0xFF) + 1;
+    clock = 2 * msel * (clock / nsel);
+  }
+
+  clock /= (CCLKCFG & 0xFF) + 1;
+
+  // PCLKSEL0 bits 3:2 divide the CPU clock by 4, 1, 2 or 8
+  switch ( (PCLKSEL0 >> 2) & 3 )
+  {
+  case 0:  return clock / 4;
+  case 1:  return clock;
+  case 2:  return clock / 2;
+  default: return clock / 8;
+  }
+}
 
 void initialize_sound_playback ( void )
 {
+  initialize_sound_playback_rate( 8000 );
+}
+
+unsigned long initialize_sound_playback_rate ( unsigned long rate )
+{
+  unsigned long clock, period;
+
+  if ( rate == 0 )
+    return 0;
+
   // Configure the P1.26 pin as DAC output
   PINSEL1 = (PINSEL1 & ~(3<<20) ) | (2<<20);
   // Disable pull-up and pull-down on the P1.26 pin
   PINMODE1 = (PINMODE1 & ~(3<<20) ) | (2<<20);
 
-  // Program the Timer 0 to throw a "match" every 125 us
+  // Program the Timer 0 to throw a "match" every sample period
   // Reset Timer 0
   T0TCR = T0TCR_Counter_Reset;
   T0TCR = 0;
 
   // Select "interrupt on match" and "reset on match" with MR0
-  T0MCR |= ( T0MCR_MR0I | T0MCR_MR0R );
+  T0MCR = T0MCR_MR0I | T0MCR_MR0R;
 
-  // Program a prescaling of 18 in the T0PR. This will make the Timer
-  // Counter (TC) increase every microsecond because PCLK is 18 MHz.
-  T0PR = 18 - 1;
+  // Count every PCLK cycle for the finest period, rounded to the
+  // nearest cycle. The timer resets on the match, so the period is MR0 + 1
+  clock = timer0_clock();
+  period = (clock + rate / 2) / rate;
+  if ( period == 0 )
+    period = 1;
 
-  // Program the match register to measure 125 us
-  T0MCR = 125 - 1;
+  T0PR = 0;
+  T0MR0 = period - 1;
 
   // Configure and enable the Timer 0 interruption -----------------
   // Map the exception vectors in RAM if the program is loaded there
@@ -76,25 +234,95 @@ void initialize_sound_playback ( void )
   VICIntEnable |= 1<<4;
 
   enable_IRQ();
+
+  return (clock + period / 2) / period;
 }
 
 void play_sound ( const unsigned short *sptr, int samples )
 {
-  samples_array = sptr;
-  sample_counter = samples;
-  // Start the timmer
-  T0TCR = T0TCR_Counter_Enable;
+  stop_sound();
+  queue_sound( sptr, samples );
+  finish_sound();
+}
+
+int queue_sound ( const unsigned short *sptr, int samples )
+{
+  int next = sound_queue.tail + 1;
+
+  if ( next == SOUND_QUEUE_BUFFERS + 1 )
+    next = 0;
+  if ( next == sound_queue.head )
+    return 0;
+
+  sound_queue.streaming = 1;
+
+  if ( samples > 0 )
+  {
+    sound_queue.buffers[sound_queue.tail].samples = sptr;
+    sound_queue.buffers[sound_queue.tail].count = samples;
+    sound_queue.tail = next;
+  }
+
+  start_playback();
+
+  return 1;
+}
+
+void play_sound_chain ( struct sound_link *first )
+{
+  stop_sound();
+  sound_queue.link = first;
+  start_playback();
+}
+
+void sound_fast_interrupt ( int enable )
+{
+  if ( enable )
+  {
+    VICIntSelect |= 1<<4;
+    enable_FIQ();
+  }
+  else
+    VICIntSelect &= ~(1<<4);
+}
+
+void finish_sound ( void )
+{
+  sound_queue.streaming = 0;
+}
+
+void stop_sound ( void )
+{
+  T0TCR = 0;
+  sound_queue.running = 0;
+  sound_queue.playing = 0;
+  sound_queue.head = sound_queue.tail = 0;
+  sound_queue.link = 0;
+  sound_queue.streaming = 0;
+  sample_counter = 0;
+}
+
+void sound_refill_callback ( void (*callback)( void ), int low_watermark )
+{
+  sound_queue.callback = callback;
+  sound_queue.low_watermark = low_watermark;
+}
+
+int sound_buffers_queued ( void )
+{
+  return queued_buffers();
+}
+
+unsigned long sound_underruns ( void )
+{
+  return sound_queue.underruns;
 }
 
 void ISR_Timer0 ( void ) /* __attribute__((interrupt ("IRQ"))) */
 {
   T0IR = T0IR_MR0;
 
-  DACR = (*samples_array)<<6;
-  samples_array++;
-
-  if ( --sample_counter == 0 )
-    T0TCR = 0;
+  play_sample();
 
   /*
    * WARNING: if the Philips_LPC230X_Startup.s file provided by
@@ -105,11 +333,12 @@ void ISR_Timer0 ( void ) /* __attribute__((interrupt ("IRQ"))) */
   VICAddress = 0;
 }
 
-void enable_IRQ ( void )
+void fiq_handler ( void ) /* __attribute__((interrupt ("FIQ"))) */
 {
-  asm ("stmfd sp!,{r0}");
-  asm ("mrs  r0,CPSR");
-  asm ("bic  r0,r0,#0x80");
-  asm ("msr  CPSR_c,r0");
-  asm ("ldmfd sp!,{r0}");
+  // The refill callback may run from here, on the FIQ stack
+  T0IR = T0IR_MR0;
+
+  play_sample();
+
+  // The fast interruptions are not vectored, VICAddress is left alone
 }
@@ -0,0 +1,291 @@
+/** \file bdf2lcd.cpp Font converter
+ *
+ * Host tool that converts a BDF bitmap font into a proportional font
+ * for LCD_print_text(), written as C arrays and an LCD_font structure.
+ *
+ * Usage: bdf2lcd [-n name] [-c ranges] font.bdf > font.c
+ *  -n name    Name of the font structure, "font" by default
+ *  -c ranges  Characters to keep, as hexadecimal codepoint ranges, e.g.
+ *             20-7E,A0-FF,20AC. All the characters by default
+ *
+ * Characters missing in the font are drawn with the glyph of U+FFFD,
+ * '?' or the first one, whichever is found first.
+ *
+ * Build it with the host compiler: g++ -o bdf2lcd bdf2lcd.cpp
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+/// Glyph read from the BDF font
+struct glyph
+{
+    unsigned int codepoint;           ///< Unicode codepoint
+    int width;                        ///< Advance width
+    int box_width, box_height;        ///< Bounding box size
+    int box_x, box_y;                 ///< Bounding box offset from the origin
+    std::vector< std::vector<unsigned char> > rows; ///< Bitmap rows, from the top one
+
+    bool operator<( const glyph &other ) const { return codepoint < other.codepoint; }
+};
+
+/// Codepoint range selected with -c
+struct range
+{
+    unsigned int first, last;
+};
+
+/// Parse the -c ranges
+static std::vector<range> parse_ranges( const char *text )
+{
+    std::vector<range> ranges;
+    range r;
+    char *end;
+
+    while( *text )
+    {
+        r.first = r.last = strtoul( text, &end, 16 );
+        if( *end == '-' )
+            r.last = strtoul( end + 1, &end, 16 );
+        ranges.push_back( r );
+
+        text = end;
+        if( *text == ',' ) text++;
+        else if( *text ) break;
+    }
+
+    return ranges;
+}
+
+/// Check if a codepoint is selected
+static bool selected( const std::vector<range> &ranges, unsigned int codepoint )
+{
+    unsigned int i;
+
+    if( ranges.empty() )
+        return true;
+
+    for( i = 0; i < ranges.size(); i++ )
+        if( codepoint >= ranges[i].first && codepoint <= ranges[i].last )
+            return true;
+
+    return false;
+}
+
+/** Parse a BITMAP row of any width: two hex digits per byte, the leftmost
+ * pixel in the most significant bit
+ */
+static std::vector<unsigned char> parse_row( const char *text )
+{
+    std::vector<unsigned char> bytes;
+    char pair[3] = { 0, 0, 0 };
+    int i, digits = strspn( text, "0123456789abcdefABCDEF" );
+
+    for( i = 0; i < digits; i += 2 )
+    {
+        pair[0] = text[i];
+        pair[1] = (i + 1 < digits) ? text[i + 1] : '0';
+        bytes.push_back( strtoul( pair, 0, 16 ) );
+    }
+
+    return bytes;
+}
+
+/// Write a list of numbers, 12 per line
+static void emit( const std::vector<unsigned int> &values, const char *format )
+{
+    unsigned int i;
+
+    for( i = 0; i < values.size(); i++ )
+    {
+        printf( (i % 12) ? " " : "\n    " );
+        printf( format, values[i] );
+        printf( "," );
+    }
+    printf( "\n    };\n\n" );
+}
+
+int main( int argc, char **argv )
+{
+    const char *name = "font";
+    const char *path = 0;
+    std::vector<range> ranges;
+    std::vector<glyph> glyphs;
+    std::vector<unsigned int> codepoints, widths, offsets, bitmaps;
+    char line[1024];
+    int ascent = -1, descent = -1, box_height = 0, box_y = 0;
+    int i, r, c, height, row_bytes, bit, y, source;
+    unsigned int k, default_glyph;
+    int encoding;
+    glyph g;
+    FILE *f;
+
+    for( i = 1; i < argc; i++ )
+    {
+        if( !strcmp( argv[i], "-n" ) && i + 1 < argc )
+            name = argv[++i];
+        else if( !strcmp( argv[i], "-c" ) && i + 1 < argc )
+            ranges = parse_ranges( argv[++i] );
+        else
+            path = argv[i];
+    }
+
+    if( !path )
+    {
+        fprintf( stderr, "Usage: %s [-n name] [-c ranges] font.bdf\n", argv[0] );
+        return 1;
+    }
+
+    f = fopen( path, "r" );
+    if( !f )
+    {
+        perror( path );
+        return 1;
+    }
+
+    encoding = -1;
+    while( fgets( line, sizeof line, f ) )
+    {
+        if( sscanf( line, "FONTBOUNDINGBOX %*d %d %*d %d", &box_height, &box_y ) == 2 )
+            continue;
+        if( sscanf( line, "FONT_ASCENT %d", &ascent ) == 1 )
+            continue;
+        if( sscanf( line, "FONT_DESCENT %d", &descent ) == 1 )
+            continue;
+
+        if( !strncmp( line, "STARTCHAR", 9 ) )
+        {
+            g = glyph();
+            encoding = -1;
+        }
+        else if( sscanf( line, "ENCODING %d", &encoding ) == 1 )
+            g.codepoint = encoding;
+        else if( sscanf( line, "DWIDTH %d", &g.width ) == 1 )
+            continue;
+        else if( sscanf( line, "BBX %d %d %d %d", &g.box_width, &g.box_height,
+                         &g.box_x, &g.box_y ) == 4 )
+            continue;
+        else if( !strncmp( line, "BITMAP", 6 ) )
+        {
+            for( r = 0; r < g.box_height && fgets( line, sizeof line, f ); r++ )
+                g.rows.push_back( parse_row( line ) );
+        }
+        else if( !strncmp( line, "ENDCHAR", 7 ) )
+        {
+            if( encoding >= 0 && encoding <= 0xFFFF && selected( ranges, encoding ) )
+                glyphs.push_back( g );
+        }
+    }
+
+    fclose( f );
+
+    if( glyphs.empty() )
+    {
+        fprintf( stderr, "%s: no glyphs\n", path );
+        return 1;
+    }
+
+    // The line spans the ascent and the descent of the font
+    if( ascent < 0 || descent < 0 )
+    {
+        descent = -box_y;
+        ascent = box_height + box_y;
+    }
+    height = ascent + descent;
+    if( height <= 0 || height > 132 )
+    {
+        fprintf( stderr, "%s: unsupported font height %d\n", path, height );
+        return 1;
+    }
+
+    std::sort( glyphs.begin(), glyphs.end() );
+
+    for( k = 0; k < glyphs.size(); k++ )
+    {
+        g = glyphs[k];
+        if( g.width > 255 ) g.width = 255;
+        if( g.width < 0 ) g.width = 0;
+
+        codepoints.push_back( g.codepoint );
+        widths.push_back( g.width );
+        offsets.push_back( bitmaps.size() );
+
+        // Place the bounding box in the cell, from the top row
+        row_bytes = (g.width + 7) / 8;
+        for( r = 0; r < height; r++ )
+        {
+            std::vector<unsigned int> row( row_bytes, 0 );
+
+            y = ascent - 1 - r;
+            source = g.box_y + g.box_height - 1 - y;
+
+            if( source >= 0 && source < (int)g.rows.size() )
+                for( c = 0; c < g.box_width; c++ )
+                {
+                    bit = g.box_x + c;
+                    if( bit >= 0 && bit < g.width && c / 8 < (int)g.rows[source].size() &&
+                        (g.rows[source][c / 8] & (0x80 >> (c % 8))) )
+                        row[bit / 8] |= 0x80 >> (bit % 8);
+                }
+
+            bitmaps.insert( bitmaps.end(), row.begin(), row.end() );
+        }
+    }
+
+    if( bitmaps.size() > 0xFFFF )
+    {
+        fprintf( stderr, "%s: the glyphs take more than 64 KiB\n", path );
+        return 1;
+    }
+
+    default_glyph = 0;
+    for( k = 0; k < glyphs.size(); k++ )
+        if( glyphs[k].codepoint == '?' )
+            default_glyph = k;
+    for( k = 0; k < glyphs.size(); k++ )
+        if( glyphs[k].codepoint == 0xFFFD )
+            default_glyph = k;
+
+    printf( "/// %s: %u glyphs, %d pixels high\n\n", path, (unsigned int)glyphs.size(), height );
+
+    printf( "static const unsigned short %s_codepoints[] = {", name );
+    emit( codepoints, "0x%04X" );
+    printf( "static const unsigned char %s_widths[] = {", name );
+    emit( widths, "%u" );
+    printf( "static const unsigned short %s_offsets[] = {", name );
+    emit( offsets, "%u" );
+    printf( "static const unsigned char %s_bitmaps[] = {", name );
+    emit( bitmaps, "0x%02X" );
+
+    printf( "const struct LCD_font %s = {\n", name );
+    printf( "    %d, %u, %u,\n", height, (unsigned int)glyphs.size(), default_glyph );
+    printf( "    %s_codepoints, %s_widths, %s_offsets, %s_bitmaps\n", name, name, name, name );
+    printf( "    };\n" );
+
+    fprintf( stderr, "%s: %u bytes\n", name, (unsigned int)(glyphs.size() * 5 + bitmaps.size() + 12) );
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+/** \file ppm2lcd.cpp Image converter
+ *
+ * Host tool that converts a PPM picture into an image for LCD_image()
+ * and LCD_sprite(), written as a C array.
+ *
+ * Usage: ppm2lcd [-r] [-n name] picture.ppm > picture.c
+ *  -r       Run-length encode the image
+ *  -n name  Name of the array, "image" by default
+ *
+ * Other formats can be converted to PPM first, e.g. with
+ * pngtopnm picture.png > picture.ppm
+ *
+ * Build it with the host compiler: g++ -o ppm2lcd ppm2lcd.cpp
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/// Read a number of the PPM header, skipping blanks and comments
+static int read_number( FILE *f )
+{
+    int c, n;
+
+    for( ;; )
+    {
+        c = fgetc( f );
+        if( c == '#' )
+            while( c != '\n' && c != EOF ) c = fgetc( f );
+        else if( c != ' ' && c != '\t' && c != '\r' && c != '\n' )
+            break;
+    }
+
+    if( c < '0' || c > '9' )
+        return -1;
+
+    for( n = 0; c >= '0' && c <= '9'; c = fgetc( f ) )
+        n = n * 10 + c - '0';
+
+    return n;
+}
+
+/// Read a sample of the picture, binary or plain
+static int read_sample( FILE *f, int binary, int maxval )
+{
+    int hi, lo;
+
+    if( !binary )
+        return read_number( f );
+
+    hi = fgetc( f );
+    if( maxval < 256 )
+        return hi;
+
+    lo = fgetc( f );
+    return (hi << 8) | lo;
+}
+
+/// Scale a sample to 4 bits, rounding to the nearest level
+static int scale( int sample, int maxval )
+{
+    return (sample * 15 + maxval / 2) / maxval;
+}
+
+/// Write a word of the array, 8 per line
+static void emit( unsigned int word, unsigned long *count )
+{
+    printf( "%s0x%04X,", (*count % 8) ? " " : "\n    ", word );
+    (*count)++;
+}
+
+int main( int argc, char **argv )
+{
+    const char *name = "image";
+    const char *path = 0;
+    int rle = 0;
+    int i, binary, width, height, maxval, x, y, r, g, b;
+    unsigned long count = 0, run;
+    FILE *f;
+    char magic[3] = { 0 };
+
+    for( i = 1; i < argc; i++ )
+    {
+        if( !strcmp( argv[i], "-r" ) )
+            rle = 1;
+        else if( !strcmp( argv[i], "-n" ) && i + 1 < argc )
+            name = argv[++i];
+        else
+            path = argv[i];
+    }
+
+    if( !path )
+    {
+        fprintf( stderr, "Usage: %s [-r] [-n name] picture.ppm\n", argv[0] );
+        return 1;
+    }
+
+    f = fopen( path, "rb" );
+    if( !f )
+    {
+        perror( path );
+        return 1;
+    }
+
+    if( fread( magic, 1, 2, f ) != 2 || magic[0] != 'P' || (magic[1] != '3' && magic[1] != '6') )
+    {
+        fprintf( stderr, "%s: not a PPM picture\n", path );
+        return 1;
+    }
+    binary = (magic[1] == '6');
+
+    width = read_number( f );
+    height = read_number( f );
+    maxval = read_number( f );
+    if( width <= 0 || height <= 0 || maxval <= 0 || width > 132 || height > 132 )
+    {
+        fprintf( stderr, "%s: the picture must be at most 132x132 pixels\n", path );
+        return 1;
+    }
+
+    std::vector<unsigned int> pixels( width * height );
+
+    // The picture rows go from the top down, and the LCD rows from the
+    // smallest X coordinate, which is the bottom of the screen, up
+    for( y = height - 1; y >= 0; y-- )
+        for( x = 0; x < width; x++ )
+        {
+            r = read_sample( f, binary, maxval );
+            g = read_sample( f, binary, maxval );
+            b = read_sample( f, binary, maxval );
+            if( b < 0 || feof( f ) )
+            {
+                fprintf( stderr, "%s: truncated picture\n", path );
+                return 1;
+            }
+            pixels[y * width + x] = (scale( r, maxval ) << 8) |
+                                    (scale( g, maxval ) << 4) | scale( b, maxval );
+        }
+
+    fclose( f );
+
+    printf( "/// %s: %dx%d pixels\n", path, width, height );
+    printf( "const unsigned short %s[] = {\n    %d, %d, %s,", name, width, height,
+            rle ? "IMAGE_RLE" : "IMAGE_RAW" );
+
+    for( i = 0; i < width * height; i += run )
+    {
+        if( !rle )
+        {
+            emit( pixels[i], &count );
+            run = 1;
+            continue;
+        }
+
+        for( run = 1; i + run < pixels.size() && run < 65535 &&
+                      pixels[i + run] == pixels[i]; run++ );
+
+        if( run < 16 )
+            emit( ((run - 1) << 12) | pixels[i], &count );
+        else
+        {
+            emit( 0xF000 | pixels[i], &count );
+            emit( run, &count );
+        }
+    }
+
+    printf( "\n    };\n" );
+
+    fprintf( stderr, "%s: %lu words\n", name, count + 3 );
+
+    return 0;
+}
@@ -0,0 +1,253 @@
+/** \file wav2snd.cpp Sound encoder
+ *
+ * Host tool that converts a WAV file into a compressed sound for
+ * sound_decode(), written as a C array.
+ *
+ * Usage: wav2snd [-u] [-n name] sound.wav > sound.c
+ *  -u       µ-law, 8 bits per sample. IMA-ADPCM, 4 bits per sample, by default
+ *  -n name  Name of the array, "sound" by default
+ *
+ * The WAV file must hold 8 or 16-bit PCM samples. Stereo files are
+ * mixed down to mono. The sample rate is kept, so play it with
+ * initialize_sound_playback_rate().
+ *
+ * Build it with the host compiler: g++ -o wav2snd wav2snd.cpp
+ */
+
+/* Copyright 2008 Victor Manuel Sánchez Corbacho.
+ * Copyright 2012 Diego Barrios Romero.
+ *
+ * This file is part of the Olimex-LPC2378-STK library.
+ *
+ * Olimex-LPC2378-STK library is free software: you can redistribute it
+ * and/or modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * Olimex-LPC2378-STK library is distributed in the hope that it will
+ * be useful, but WITHOUT ANY WARRANTY; without even the implied
+ * warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Olimex-LPC2378-STK library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// Same values as in codec.h
+#define SOUND_ULAW 1
+#define SOUND_ADPCM 2
+
+/// IMA-ADPCM quantizer step sizes
+static const int adpcm_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+
+/// IMA-ADPCM step index change for each code magnitude
+static const int adpcm_index_changes[8] = {
+    -1, -1, -1, -1, 2, 4, 6, 8
+    };
+
+/// Read a little-endian number of the WAV file
+static unsigned long read_le( const unsigned char *p, int bytes )
+{
+    unsigned long n = 0;
+
+    while( bytes-- )
+        n = (n << 8) | p[bytes];
+
+    return n;
+}
+
+/// Compress a 16-bit sample to µ-law
+static unsigned char ulaw_code( int sample )
+{
+    int mask, segment;
+
+    if( sample < 0 )
+    {
+        sample = -sample;
+        mask = 0x7F;
+    }
+    else
+        mask = 0xFF;
+
+    if( sample > 32635 ) sample = 32635;
+    sample += 0x84;
+
+    for( segment = 0; segment < 7 && sample >= (0x100 << segment); segment++ );
+
+    return ((segment << 4) | ((sample >> (segment + 3)) & 0x0F)) ^ mask;
+}
+
+/** Compress a 16-bit sample to an IMA-ADPCM code, tracking the decoder
+ * state so both stay the same
+ */
+static int adpcm_code( int sample, int *predictor, int *index )
+{
+    int step = adpcm_steps[*index];
+    int difference = sample - *predictor;
+    int code = 0, decoded;
+
+    if( difference < 0 )
+    {
+        code = 8;
+        difference = -difference;
+    }
+
+    if( difference >= step ) { code |= 4; difference -= step; }
+    if( difference >= step >> 1 ) { code |= 2; difference -= step >> 1; }
+    if( difference >= step >> 2 ) code |= 1;
+
+    // Decode it as sound_decode() does
+    decoded = step >> 3;
+    if( code & 4 ) decoded += step;
+    if( code & 2 ) decoded += step >> 1;
+    if( code & 1 ) decoded += step >> 2;
+
+    *predictor += (code & 8) ? -decoded : decoded;
+    if( *predictor > 32767 ) *predictor = 32767;
+    if( *predictor < -32768 ) *predictor = -32768;
+
+    *index += adpcm_index_changes[code & 7];
+    if( *index < 0 ) *index = 0;
+    if( *index > 88 ) *index = 88;
+
+    return code;
+}
+
+int main( int argc, char **argv )
+{
+    const char *name = "sound";
+    const char *path = 0;
+    int format = SOUND_ADPCM;
+    std::vector<unsigned char> file, bytes;
+    std::vector<int> samples;
+    unsigned long rate = 0, channels = 0, bits = 0, size, i, c, pos;
+    const unsigned char *data = 0;
+    unsigned long data_size = 0;
+    int predictor = 0, index = 0, sample, code;
+    FILE *f;
+
+    for( i = 1; i < (unsigned long)argc; i++ )
+    {
+        if( !strcmp( argv[i], "-u" ) )
+            format = SOUND_ULAW;
+        else if( !strcmp( argv[i], "-n" ) && i + 1 < (unsigned long)argc )
+            name = argv[++i];
+        else
+            path = argv[i];
+    }
+
+    if( !path )
+    {
+        fprintf( stderr, "Usage: %s [-u] [-n name] sound.wav\n", argv[0] );
+        return 1;
+    }
+
+    f = fopen( path, "rb" );
+    if( !f )
+    {
+        perror( path );
+        return 1;
+    }
+
+    while( (sample = fgetc( f )) != EOF )
+        file.push_back( sample );
+    fclose( f );
+
+    if( file.size() < 12 || memcmp( &file[0], "RIFF", 4 ) || memcmp( &file[8], "WAVE", 4 ) )
+    {
+        fprintf( stderr, "%s: not a WAV file\n", path );
+        return 1;
+    }
+
+    // Look for the format and data chunks
+    for( pos = 12; pos + 8 <= file.size(); pos += 8 + size + (size & 1) )
+    {
+        size = read_le( &file[pos + 4], 4 );
+        if( pos + 8 + size > file.size() )
+            size = file.size() - pos - 8;
+
+        if( !memcmp( &file[pos], "fmt ", 4 ) && size >= 16 )
+        {
+            if( read_le( &file[pos + 8], 2 ) != 1 )
+            {
+                fprintf( stderr, "%s: only PCM samples are supported\n", path );
+                return 1;
+            }
+            channels = read_le( &file[pos + 10], 2 );
+            rate = read_le( &file[pos + 12], 4 );
+            bits = read_le( &file[pos + 22], 2 );
+        }
+        else if( !memcmp( &file[pos], "data", 4 ) )
+        {
+            data = &file[pos + 8];
+            data_size = size;
+        }
+    }
+
+    if( !data || !channels || (bits != 8 && bits != 16) || rate == 0 || rate > 65535 )
+    {
+        fprintf( stderr, "%s: unsupported WAV file\n", path );
+        return 1;
+    }
+
+    // Mix the channels to 16-bit mono samples
+    for( pos = 0; pos + channels * bits / 8 <= data_size; pos += channels * bits / 8 )
+    {
+        sample = 0;
+        for( c = 0; c < channels; c++ )
+        {
+            if( bits == 8 )
+                sample += (data[pos + c] - 128) << 8;
+            else
+                sample += (short)read_le( data + pos + 2 * c, 2 );
+        }
+        samples.push_back( sample / (int)channels );
+    }
+
+    bytes.push_back( format );
+    bytes.push_back( rate & 0xFF );
+    bytes.push_back( (rate >> 8) & 0xFF );
+    for( i = 0; i < 4; i++ )
+        bytes.push_back( (samples.size() >> (8 * i)) & 0xFF );
+
+    for( i = 0; i < samples.size(); i++ )
+    {
+        if( format == SOUND_ULAW )
+        {
+            bytes.push_back( ulaw_code( samples[i] ) );
+            continue;
+        }
+
+        // Two codes per byte, the first one in the low nibble
+        code = adpcm_code( samples[i], &predictor, &index );
+        if( i & 1 )
+            bytes.back() |= code << 4;
+        else
+            bytes.push_back( code );
+    }
+
+    printf( "/// %s: %lu samples at %lu Hz, %s\n", path, (unsigned long)samples.size(), rate,
+            (format == SOUND_ULAW) ? "SOUND_ULAW" : "SOUND_ADPCM" );
+    printf( "const unsigned char %s[] = {", name );
+    for( i = 0; i < bytes.size(); i++ )
+        printf( "%s0x%02X,", (i % 12) ? " " : "\n    ", bytes[i] );
+    printf( "\n    };\n" );
+
+    fprintf( stderr, "%s: %lu bytes, %lu as raw samples\n", name,
+             (unsigned long)bytes.size(), (unsigned long)samples.size() * 2 );
+
+    return 0;
+}